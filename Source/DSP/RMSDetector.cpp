@@ -54,7 +54,12 @@ void RMSDetector::updateBufferSize()
     // Clamp writeIndex to new logical size (no reallocation needed)
     if (writeIndex >= bufferSize)
         writeIndex = 0;
+
+    // Resync the sum with the samples now in the window; zeroing it would leave
+    // it out of step with what gets subtracted until the next full recalculation
     runningSum = 0.0f;
+    for (int i = 0; i < bufferSize; ++i)
+        runningSum += squaredBuffer[static_cast<size_t>(i)];
 }
 
 void RMSDetector::setWindowSize(float newWindowSizeMs)
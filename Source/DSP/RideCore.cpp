@@ -0,0 +1,298 @@
+/*
+  ==============================================================================
+
+    RideCore.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RideCore.h"
+#include "RideDetector.h"
+
+RideCore::RideCore()
+{
+}
+
+void RideCore::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+
+    gainSmoother.prepare(sampleRate);
+    lastAttackMs = -1.0f;
+    lastReleaseMs = -1.0f;
+    lastHoldMs = -1.0f;
+
+    // Phrase detection parameters
+    phraseMinSamples = static_cast<int>(0.1 * sampleRate);
+    silenceMinSamples = static_cast<int>(0.15 * sampleRate);
+    phraseMaxSamples = static_cast<int>(maxPhraseSeconds * sampleRate);
+
+    setSettings(settings);
+    reset();
+}
+
+void RideCore::reset()
+{
+    gainSmoother.reset();
+    lastTargetGainDb = 0.0f;
+
+    gateOpen = false;
+    gateSmoothedLevel = -100.0f;
+
+    resetPhrase();
+}
+
+void RideCore::resetPhrase()
+{
+    inPhrase = false;
+    phraseAccumulator = 0.0;
+    phraseSampleCount = 0;
+    currentPhraseGainDb = 0.0f;
+    silenceSampleCount = 0;
+    phraseGainSmoother = 0.0f;
+    phraseLastLevelDb = -100.0f;
+}
+
+void RideCore::clearPhraseGain()
+{
+    inPhrase = false;
+    phraseGainSmoother = 0.0f;
+    currentPhraseGainDb = 0.0f;
+}
+
+//==============================================================================
+void RideCore::setSettings(const RideSettings& newSettings)
+{
+    settings = newSettings;
+
+    // Only update when changed to avoid needless exp() calls
+    if (std::abs(settings.attackMs - lastAttackMs) > 0.01f)
+    {
+        gainSmoother.setAttackTime(settings.attackMs);
+        lastAttackMs = settings.attackMs;
+    }
+    if (std::abs(settings.releaseMs - lastReleaseMs) > 0.01f)
+    {
+        gainSmoother.setReleaseTime(settings.releaseMs);
+        lastReleaseMs = settings.releaseMs;
+    }
+    if (std::abs(settings.holdMs - lastHoldMs) > 0.01f)
+    {
+        gainSmoother.setHoldTime(settings.holdMs);
+        lastHoldMs = settings.holdMs;
+    }
+
+    // Natural mode phrase smoothing (slightly slower attack/release for a natural feel)
+    const float sr = static_cast<float>(sampleRate);
+    phraseAttackCoeff = std::exp(-1.0f / (settings.attackMs * 1.5f * sr / 1000.0f));
+    phraseReleaseCoeff = std::exp(-1.0f / (settings.releaseMs * 1.5f * sr / 1000.0f));
+
+    // Use hold time concept: don't end phrase immediately
+    phraseHoldSamples = juce::jmax(static_cast<int>(settings.holdMs * sampleRate / 1000.0), silenceMinSamples);
+}
+
+void RideCore::setBlockAnalysis(float measuredLufs, bool breathDetected)
+{
+    blockLufs = measuredLufs;
+    blockIsBreath = breathDetected;
+}
+
+void RideCore::setGainOverride(bool shouldOverride, float gainDb)
+{
+    gainOverrideActive = shouldOverride;
+    gainOverrideDb = gainDb;
+}
+
+//==============================================================================
+void RideCore::processBlock(const RideDetector& detector, int numSamples, float* gainDbOut)
+{
+    setBlockAnalysis(detector.getLufs(), detector.isBreathDetected());
+
+    const float* filtered = detector.getFilteredSamples();
+    const float* rms = detector.getRmsDb();
+    const float* peak = detector.getPeakDb();
+    const float* peakAhead = detector.getPeakAheadDb();
+
+    for (int i = 0; i < numSamples; ++i)
+        gainDbOut[i] = processSample(filtered[i], rms[i], peak[i], peakAhead[i]);
+}
+
+float RideCore::processSample(float detectorSample, float rmsLevelDb, float peakLevelDb, float peakAheadDb)
+{
+    // === NOISE GATE LOGIC ===
+    float currentLevel = juce::jmax(rmsLevelDb, peakLevelDb);
+    float smoothCoeff = (currentLevel > gateSmoothedLevel) ? gateSmoothAttack : gateSmoothRelease;
+    gateSmoothedLevel = smoothCoeff * gateSmoothedLevel + (1.0f - smoothCoeff) * currentLevel;
+
+    // Gate with hysteresis
+    if (!gateOpen && gateSmoothedLevel > gateThresholdDb + gateHysteresisDb)
+        gateOpen = true;
+    else if (gateOpen && gateSmoothedLevel < gateThresholdDb)
+        gateOpen = false;
+
+    float targetGainDb;
+
+    // === NOISE FLOOR CHECK ===
+    // Active when above minimum (-60 dB); below it the signal is treated as silence
+    if (settings.noiseFloorDb > -59.9f && currentLevel < settings.noiseFloorDb)
+        targetGainDb = getSilenceGainDb();
+    else if (settings.naturalMode)
+        targetGainDb = computeNaturalGain(detectorSample, rmsLevelDb, peakLevelDb);
+    else
+        targetGainDb = computeStandardGain(rmsLevelDb, peakLevelDb, peakAheadDb);
+
+    // === READ MODE: Override calculated gain with DAW automation ===
+    if (gainOverrideActive)
+        targetGainDb = gainOverrideDb;
+
+    lastTargetGainDb = targetGainDb;
+    return gainSmoother.processSample(targetGainDb);
+}
+
+//==============================================================================
+float RideCore::shapeGain(float gainNeeded, float rmsLevelDb, float peakLevelDb) const
+{
+    // === BREATH REDUCTION ===
+    if (settings.breathReductionDb > 0.0f && blockIsBreath)
+        gainNeeded = juce::jmin(gainNeeded, -settings.breathReductionDb);
+
+    // === TRANSIENT PRESERVATION ===
+    if (settings.transientPreservation > 0.0f && peakLevelDb > rmsLevelDb + 6.0f)
+    {
+        // Reduce gain adjustment during transients to preserve dynamics
+        float transientAmount = (peakLevelDb - rmsLevelDb - 6.0f) / 12.0f;
+        transientAmount = juce::jlimit(0.0f, 1.0f, transientAmount) * settings.transientPreservation;
+        gainNeeded *= (1.0f - transientAmount * 0.7f);
+    }
+
+    // Soft knee
+    if (std::abs(gainNeeded) < kneeWidthDb)
+    {
+        float ratio = gainNeeded / kneeWidthDb;
+        gainNeeded = gainNeeded * (0.5f + 0.5f * ratio * ratio * (gainNeeded > 0 ? 1.0f : -1.0f));
+    }
+
+    float gainDb = juce::jlimit(-settings.cutRangeDb, settings.boostRangeDb, gainNeeded);
+
+    // === PEAK-AWARE GAIN LIMITING ===
+    // Prevent boost from pushing peaks past the soft clipper ceiling.
+    // Without this, the RMS-based gain decision can boost hot signals into clipping
+    // because RMS is always lower than peak (crest factor).
+    if (gainDb > 0.0f)
+    {
+        static constexpr float peakSafeCeiling = -1.0f;  // dB headroom below 0 dBFS
+        float peakAfterGain = peakLevelDb + gainDb;
+        if (peakAfterGain > peakSafeCeiling)
+            gainDb = juce::jmax(0.0f, peakSafeCeiling - peakLevelDb);
+    }
+
+    return gainDb;
+}
+
+float RideCore::computeNaturalGain(float detectorSample, float rmsLevelDb, float peakLevelDb)
+{
+    // === PHRASE-BASED (NATURAL) MODE ===
+    // Use the already-computed RMS level for phrase detection (much more stable
+    // than per-sample level analysis)
+    bool audioPresent = rmsLevelDb > gateThresholdDb;
+
+    // Track smoothed energy changes for phrase boundary detection
+    float smoothCoeffPhrase = 0.995f;  // Very smooth tracking
+    float smoothedPhraseLevel = smoothCoeffPhrase * phraseLastLevelDb + (1.0f - smoothCoeffPhrase) * rmsLevelDb;
+    float energyDelta = std::abs(smoothedPhraseLevel - phraseLastLevelDb);
+    phraseLastLevelDb = smoothedPhraseLevel;
+
+    // Only detect energy jumps when the change is genuinely large AND sustained
+    bool energyJump = (energyDelta > 6.0f && rmsLevelDb > gateThresholdDb + 8.0f
+                      && phraseSampleCount > phraseMinSamples * 2);
+
+    if (audioPresent)
+    {
+        silenceSampleCount = 0;
+
+        // Start new phrase on: first audio after silence, OR very significant energy jump
+        if (!inPhrase)
+        {
+            inPhrase = true;
+            phraseAccumulator = 0.0;
+            phraseSampleCount = 0;
+        }
+        else if (energyJump)
+        {
+            // Soft reset for energy-based phrase change (keep some history)
+            phraseAccumulator *= 0.5;
+            phraseSampleCount = static_cast<int>(phraseSampleCount * 0.5f);
+        }
+
+        // Accumulate for phrase level calculation
+        phraseAccumulator += static_cast<double>(detectorSample) * detectorSample;
+        phraseSampleCount++;
+
+        // A phrase that never ends (sustained input) must not integrate forever:
+        // the count would overflow after ~12 h. Decay to a sliding average instead.
+        if (phraseSampleCount > phraseMaxSamples)
+        {
+            phraseAccumulator *= static_cast<double>(phraseMaxSamples) / static_cast<double>(phraseSampleCount);
+            phraseSampleCount = phraseMaxSamples;
+        }
+
+        // Calculate running phrase level and gain
+        if (phraseSampleCount > phraseMinSamples / 4)  // After initial samples
+        {
+            float phraseRms = static_cast<float>(std::sqrt(phraseAccumulator / static_cast<double>(phraseSampleCount)));
+            float phraseLevelDb = juce::Decibels::gainToDecibels(phraseRms, -100.0f);
+            currentPhraseGainDb = shapeGain(settings.targetDb - phraseLevelDb, rmsLevelDb, peakLevelDb);
+        }
+    }
+    else
+    {
+        silenceSampleCount++;
+
+        if (inPhrase && silenceSampleCount > phraseHoldSamples)
+            inPhrase = false;  // End of phrase detected
+    }
+
+    // Target gain: phrase gain when in phrase, silence gain otherwise
+    float targetPhraseGain = inPhrase ? currentPhraseGainDb : getSilenceGainDb();
+
+    // Attack for rising gain, release for falling gain
+    float phraseSmooth = (targetPhraseGain - phraseGainSmoother > 0) ? phraseAttackCoeff : phraseReleaseCoeff;
+    phraseGainSmoother = phraseSmooth * phraseGainSmoother + (1.0f - phraseSmooth) * targetPhraseGain;
+
+    float targetGainDb = phraseGainSmoother;
+
+    // Don't boost silence (apply smart silence reduction if enabled)
+    if (!gateOpen)
+        targetGainDb = juce::jmin(targetGainDb, getSilenceGainDb());
+
+    return targetGainDb;
+}
+
+float RideCore::computeStandardGain(float rmsLevelDb, float peakLevelDb, float peakAheadDb)
+{
+    // === STANDARD MODE (sample-by-sample) ===
+    // Use LUFS or RMS based on mode
+    float baseLevelDb = settings.useLufs ? blockLufs : rmsLevelDb;
+
+    // Blend peak and RMS for transient sensitivity
+    float effectiveLevelDb = baseLevelDb;
+    if (peakLevelDb > baseLevelDb + 3.0f)
+        effectiveLevelDb = baseLevelDb + (peakLevelDb - baseLevelDb) * 0.7f;
+
+    // If using predictive look-ahead, blend with peak-ahead levels
+    if (settings.useLookAhead && peakAheadDb > effectiveLevelDb)
+        effectiveLevelDb = effectiveLevelDb + (peakAheadDb - effectiveLevelDb) * 0.6f;
+
+    float targetGainDb = shapeGain(settings.targetDb - effectiveLevelDb, rmsLevelDb, peakLevelDb);
+
+    // Noise gate: Apply smart silence reduction if enabled
+    if (!gateOpen)
+        targetGainDb = juce::jmin(targetGainDb, getSilenceGainDb());
+
+    if (effectiveLevelDb < gateThresholdDb - 10.0f)
+        targetGainDb = juce::jmin(targetGainDb, 0.0f);
+
+    return targetGainDb;
+}
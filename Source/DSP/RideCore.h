@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    RideCore.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Gain decision and smoothing stage of the rider. Takes the per-sample
+    level data produced by RideDetector and turns it into a smoothed gain
+    curve (Natural phrase-based mode or Standard sample-by-sample mode).
+    Holds only ride state, so several cores can share one detector.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "GainSmoother.h"
+#include "RideSettings.h"
+
+class RideDetector;
+
+class RideCore
+{
+public:
+    RideCore();
+    ~RideCore() = default;
+
+    //==============================================================================
+    void prepare(double sampleRate);
+
+    /** Resets gate, phrase and smoother state */
+    void reset();
+
+    /** Forgets the current phrase (Natural mode toggle, transport restart) */
+    void resetPhrase();
+
+    /** Ends the current phrase and drops its gain (sustained silence) */
+    void clearPhraseGain();
+
+    //==============================================================================
+    /** Applies a settings snapshot. Call once per block before processing;
+        smoother coefficients are only recomputed when timing actually changes.
+    */
+    void setSettings(const RideSettings& newSettings);
+    const RideSettings& getSettings() const { return settings; }
+
+    /** Block-level analysis results that the per-sample decision depends on */
+    void setBlockAnalysis(float measuredLufs, bool breathDetected);
+
+    /** Overrides the calculated gain (automation Read mode). State keeps tracking. */
+    void setGainOverride(bool shouldOverride, float gainDb);
+
+    //==============================================================================
+    /** Processes one sample of detector data and returns the smoothed gain in dB.
+        @param detectorSample Vocal-focus filtered input sample
+        @param rmsLevelDb     RMS envelope of the filtered input
+        @param peakLevelDb    Peak envelope of the filtered input
+        @param peakAheadDb    Predictive peak level (-100 when look-ahead is off)
+    */
+    float processSample(float detectorSample, float rmsLevelDb, float peakLevelDb, float peakAheadDb);
+
+    /** Runs a whole block from a detector, writing the smoothed gain (dB) per sample */
+    void processBlock(const RideDetector& detector, int numSamples, float* gainDbOut);
+
+    //==============================================================================
+    bool isInPhrase() const { return inPhrase; }
+    bool isGateOpen() const { return gateOpen; }
+    float getCurrentGainDb() const { return gainSmoother.getCurrentGainDb(); }
+    /** Unsmoothed gain the last processSample() decided on (before the smoother) */
+    float getTargetGainDb() const { return lastTargetGainDb; }
+
+    // Noise gate parameters
+    static constexpr float gateThresholdDb = -45.0f;
+    static constexpr float gateHysteresisDb = 3.0f;
+    static constexpr float silenceGainDbReduction = -6.0f;  // When smart silence is ON
+
+    // Soft knee parameters
+    static constexpr float kneeWidthDb = 6.0f;
+
+private:
+    //==============================================================================
+    float computeNaturalGain(float detectorSample, float rmsLevelDb, float peakLevelDb);
+    float computeStandardGain(float rmsLevelDb, float peakLevelDb, float peakAheadDb);
+    /** Breath reduction, transient preservation, soft knee, range clamp and peak limit */
+    float shapeGain(float gainNeeded, float rmsLevelDb, float peakLevelDb) const;
+
+    // Smart Silence helper
+    float getSilenceGainDb() const { return settings.smartSilence ? silenceGainDbReduction : 0.0f; }
+
+    //==============================================================================
+    double sampleRate = 44100.0;
+    RideSettings settings;
+
+    GainSmoother gainSmoother;
+    float lastAttackMs = -1.0f;
+    float lastReleaseMs = -1.0f;
+    float lastHoldMs = -1.0f;
+
+    // Block-level analysis
+    float blockLufs = -100.0f;
+    bool blockIsBreath = false;
+    bool gainOverrideActive = false;
+    float gainOverrideDb = 0.0f;
+    float lastTargetGainDb = 0.0f;
+
+    // Gate smoothing coefficient (fast attack, slower release)
+    static constexpr float gateSmoothAttack = 0.99f;
+    static constexpr float gateSmoothRelease = 0.9995f;
+    bool gateOpen = false;
+    float gateSmoothedLevel = -100.0f;
+
+    // Phrase-based processing (Natural Mode)
+    bool inPhrase = false;
+    double phraseAccumulator = 0.0;     // Double: single-sample increments stay exact over long phrases
+    int phraseSampleCount = 0;
+    int phraseMaxSamples = 0;           // Integration window cap (long phrases become a sliding average)
+    float currentPhraseGainDb = 0.0f;
+    int silenceSampleCount = 0;
+    int phraseMinSamples = 0;
+    int silenceMinSamples = 0;
+
+    static constexpr double maxPhraseSeconds = 30.0;
+    float phraseGainSmoother = 0.0f;
+    float phraseLastLevelDb = -100.0f;  // For energy delta tracking
+
+    // Derived per settings change (Natural mode uses slightly slower timing)
+    float phraseAttackCoeff = 0.0f;
+    float phraseReleaseCoeff = 0.0f;
+    int phraseHoldSamples = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RideCore)
+};
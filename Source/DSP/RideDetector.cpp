@@ -0,0 +1,275 @@
+/*
+  ==============================================================================
+
+    RideDetector.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RideDetector.h"
+
+RideDetector::RideDetector()
+{
+}
+
+void RideDetector::prepare(double newSampleRate, int newMaxBlockSize, float speed)
+{
+    sampleRate = newSampleRate;
+    maxBlockSize = juce::jmax(1, newMaxBlockSize);
+
+    rmsDetector.prepare(sampleRate, speedToWindowMs(speed));
+    lastSpeed = speed;
+
+    peakDetector.prepare(sampleRate);
+    peakDetector.setAttackTime(0.1f);
+    peakDetector.setReleaseTime(50.0f);
+
+    juce::dsp::ProcessSpec spec;
+    spec.sampleRate = sampleRate;
+    spec.maximumBlockSize = static_cast<juce::uint32>(maxBlockSize);
+    spec.numChannels = 1;
+
+    sidechainHPF.prepare(spec);
+    sidechainHPF.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+    sidechainHPF.setCutoffFrequency(200.0f);  // Focus on vocal fundamentals and up
+    sidechainHPF.setResonance(0.707f);
+
+    sidechainLPF.prepare(spec);
+    sidechainLPF.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
+    sidechainLPF.setCutoffFrequency(4000.0f);  // Cut high-frequency sibilance/noise
+    sidechainLPF.setResonance(0.707f);
+
+    vocalFocusHighPass.prepare(spec);
+    vocalFocusHighPass.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+    vocalFocusHighPass.setCutoffFrequency(180.0f);  // Cut low rumble below vocal range
+    vocalFocusHighPass.setResonance(0.707f);
+
+    vocalFocusLowPass.prepare(spec);
+    vocalFocusLowPass.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
+    vocalFocusLowPass.setCutoffFrequency(5000.0f);  // Cut high frequencies above vocal presence
+    vocalFocusLowPass.setResonance(0.707f);
+
+    // LUFS K-weighting filters
+    lufsPreFilter.prepare(spec);
+    lufsPreFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+    lufsPreFilter.setCutoffFrequency(38.0f);  // High-pass for K-weighting
+    lufsPreFilter.setResonance(0.5f);
+
+    lufsHighShelf.prepare(spec);
+    lufsHighShelf.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+    lufsHighShelf.setCutoffFrequency(1500.0f);  // Approximate high shelf boost
+    lufsHighShelf.setResonance(0.707f);
+
+    filtered.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    rmsDb.assign(static_cast<size_t>(maxBlockSize), -100.0f);
+    peakDb.assign(static_cast<size_t>(maxBlockSize), -100.0f);
+    peakAheadDb.assign(static_cast<size_t>(maxBlockSize), -100.0f);
+
+    reset();
+}
+
+void RideDetector::reset()
+{
+    rmsDetector.reset();
+    peakDetector.reset();
+
+    sidechainHPF.reset();
+    sidechainLPF.reset();
+    vocalFocusHighPass.reset();
+    vocalFocusLowPass.reset();
+    lufsPreFilter.reset();
+    lufsHighShelf.reset();
+
+    resetLufs();
+
+    isBreath = false;
+    breathEnvelope = 0.0f;
+}
+
+void RideDetector::resetLufs()
+{
+    lufsIntegrator = 0.0f;
+    lufsSampleCount = 0;
+    measuredLufs = -100.0f;
+}
+
+//==============================================================================
+void RideDetector::process(const float* monoSamples, int numSamples, const RideSettings& settings)
+{
+    if (numSamples <= 0 || numSamples > maxBlockSize)
+        return;
+
+    // Update speed-dependent RMS window (always keep in sync)
+    if (std::abs(settings.speed - lastSpeed) > 0.5f)
+    {
+        rmsDetector.setWindowSize(speedToWindowMs(settings.speed));
+        lastSpeed = settings.speed;
+    }
+
+    // === VOCAL FOCUS FILTER (frequency-weighted detection) ===
+    std::copy(monoSamples, monoSamples + numSamples, filtered.begin());
+    {
+        float* channels[] = { filtered.data() };
+        juce::dsp::AudioBlock<float> block(channels, 1, static_cast<size_t>(numSamples));
+        juce::dsp::ProcessContextReplacing<float> filterContext(block);
+
+        if (settings.vocalFocus)
+        {
+            vocalFocusHighPass.process(filterContext);  // Cut below 180Hz
+            vocalFocusLowPass.process(filterContext);   // Cut above 5kHz
+        }
+        else
+        {
+            sidechainHPF.process(filterContext);  // High-pass at 200Hz
+            sidechainLPF.process(filterContext);  // Low-pass at 4kHz
+        }
+    }
+
+    // === LUFS CALCULATION (if enabled) ===
+    measuredLufs = settings.useLufs ? calculateLufs(monoSamples, numSamples) : -100.0f;
+
+    // === BREATH DETECTION (block-level) ===
+    if (settings.breathReductionDb > 0.0f)
+    {
+        float spectralFlat = calculateSpectralFlatness(monoSamples, numSamples);
+        float zeroCross = calculateZeroCrossingRate(monoSamples, numSamples);
+        isBreath = detectBreath(spectralFlat, zeroCross);
+    }
+
+    // === PREDICTIVE LOOK-AHEAD: Pre-scan for peaks ===
+    std::fill(peakAheadDb.begin(), peakAheadDb.begin() + numSamples, -100.0f);
+    if (settings.useLookAhead && settings.lookAheadSamples > 0)
+        scanPeakAhead(numSamples, settings.lookAheadSamples);
+
+    // === LEVEL ENVELOPES (on the filtered signal) ===
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float x = filtered[static_cast<size_t>(i)];
+        rmsDb[static_cast<size_t>(i)] = rmsDetector.processSample(x);
+        peakDb[static_cast<size_t>(i)] = peakDetector.processSample(x);
+    }
+}
+
+void RideDetector::scanPeakAhead(int numSamples, int lookAheadSamples)
+{
+    int scanWindow = juce::jmin(lookAheadSamples, numSamples);
+
+    // O(n) windowed maximum using a backward pass, reset at window boundaries
+    float runningMax = 0.0f;
+    for (int sample = numSamples - 1; sample >= 0; --sample)
+    {
+        if ((numSamples - 1 - sample) % scanWindow == 0)
+            runningMax = 0.0f;
+        runningMax = juce::jmax(runningMax, std::abs(filtered[static_cast<size_t>(sample)]));
+        peakAheadDb[static_cast<size_t>(sample)] = runningMax;
+    }
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        peakAheadDb[static_cast<size_t>(sample)] =
+            juce::Decibels::gainToDecibels(peakAheadDb[static_cast<size_t>(sample)], -100.0f);
+    }
+}
+
+//==============================================================================
+float RideDetector::calculateLufs(const float* samples, int numSamples)
+{
+    // Simplified LUFS calculation with K-weighting approximation
+    float sumSquared = 0.0f;
+    
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Apply K-weighting (simplified)
+        float filteredSample = lufsPreFilter.processSample(0, samples[i]);
+        filteredSample = lufsHighShelf.processSample(0, filteredSample) * 1.4f + filteredSample;  // Boost highs
+        sumSquared += filteredSample * filteredSample;
+    }
+    
+    lufsIntegrator += sumSquared;
+    lufsSampleCount += numSamples;
+    
+    // Prevent unbounded accumulation: use ~3 second sliding window
+    // Reset when we exceed the window, preserving recent average
+    int maxLufsSamples = static_cast<int>(3.0 * sampleRate);
+    if (maxLufsSamples > 0 && lufsSampleCount > maxLufsSamples)
+    {
+        // Decay integrator to approximate sliding window
+        float ratio = static_cast<float>(maxLufsSamples) / static_cast<float>(lufsSampleCount);
+        lufsIntegrator *= ratio;
+        lufsSampleCount = maxLufsSamples;
+    }
+    
+    if (lufsSampleCount > 0)
+    {
+        float meanSquared = lufsIntegrator / static_cast<float>(lufsSampleCount);
+        float rms = std::sqrt(meanSquared);
+        return juce::Decibels::gainToDecibels(rms, -100.0f) - 0.691f;  // LUFS offset
+    }
+    
+    return -100.0f;
+}
+
+float RideDetector::calculateSpectralFlatness(const float* samples, int numSamples)
+{
+    // Spectral flatness: ratio of geometric mean to arithmetic mean
+    // High value = noise-like (breath), Low value = tonal (voice)
+    
+    if (numSamples < 2) return 0.0f;
+    
+    float sumAbs = 0.0f;
+    float sumLog = 0.0f;
+    int validSamples = 0;
+    
+    // On older hardware, downsample for large blocks to reduce expensive log() calls
+    int step = (numSamples > 256) ? 4 : 1;
+    
+    for (int i = 0; i < numSamples; i += step)
+    {
+        float absVal = std::abs(samples[i]);
+        if (absVal > 1e-10f)
+        {
+            sumAbs += absVal;
+            sumLog += std::log(absVal);
+            validSamples++;
+        }
+    }
+    
+    if (validSamples < 2) return 0.0f;
+    
+    float arithmeticMean = sumAbs / static_cast<float>(validSamples);
+    float geometricMean = std::exp(sumLog / static_cast<float>(validSamples));
+    
+    if (arithmeticMean < 1e-10f) return 0.0f;
+    
+    return geometricMean / arithmeticMean;
+}
+
+float RideDetector::calculateZeroCrossingRate(const float* samples, int numSamples)
+{
+    if (numSamples < 2) return 0.0f;
+    
+    int crossings = 0;
+    for (int i = 1; i < numSamples; ++i)
+    {
+        if ((samples[i] >= 0.0f) != (samples[i - 1] >= 0.0f))
+            crossings++;
+    }
+    
+    return static_cast<float>(crossings) / static_cast<float>(numSamples - 1);
+}
+
+bool RideDetector::detectBreath(float spectralFlatness, float zeroCrossRate)
+{
+    // Breaths have: high spectral flatness (noisy), high zero-crossing rate
+    // Voice has: low spectral flatness (tonal), moderate zero-crossing rate
+    
+    bool likelyBreath = (spectralFlatness > 0.3f && zeroCrossRate > 0.2f);
+    
+    // Smooth the breath detection
+    float target = likelyBreath ? 1.0f : 0.0f;
+    breathEnvelope = 0.95f * breathEnvelope + 0.05f * target;
+    
+    return breathEnvelope > 0.5f;
+}
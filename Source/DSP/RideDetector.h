@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    RideDetector.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Detection front-end of the rider: vocal-focus filtering, RMS and peak
+    envelopes, the predictive peak-ahead scan, LUFS and breath detection.
+    Produces per-sample level data for RideCore to make gain decisions on.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+#include "RMSDetector.h"
+#include "PeakDetector.h"
+#include "RideSettings.h"
+
+class RideDetector
+{
+public:
+    RideDetector();
+    ~RideDetector() = default;
+
+    //==============================================================================
+    /** Prepares filters and allocates per-block storage.
+        @param sampleRate   The sample rate of the audio
+        @param maxBlockSize Largest block process() will ever be called with
+        @param speed        Initial speed (sets the RMS window)
+    */
+    void prepare(double sampleRate, int maxBlockSize, float speed);
+
+    /** Resets envelopes and filter state */
+    void reset();
+
+    /** Clears the LUFS integrator (e.g. when switching detection mode) */
+    void resetLufs();
+
+    //==============================================================================
+    /** Analyses one block of mono input. Results stay valid until the next call.
+        Does nothing if numSamples exceeds the prepared block size.
+    */
+    void process(const float* monoSamples, int numSamples, const RideSettings& settings);
+
+    /** Vocal-focus filtered input (what the ride decisions are based on) */
+    const float* getFilteredSamples() const { return filtered.data(); }
+    const float* getRmsDb() const { return rmsDb.data(); }
+    const float* getPeakDb() const { return peakDb.data(); }
+    /** Predictive peak levels, or -100 dB when look-ahead is off */
+    const float* getPeakAheadDb() const { return peakAheadDb.data(); }
+
+    float getLufs() const { return measuredLufs; }
+    bool isBreathDetected() const { return isBreath; }
+
+    int getMaxBlockSize() const { return maxBlockSize; }
+
+private:
+    //==============================================================================
+    float calculateLufs(const float* samples, int numSamples);
+    float calculateSpectralFlatness(const float* samples, int numSamples);
+    float calculateZeroCrossingRate(const float* samples, int numSamples);
+    bool detectBreath(float spectralFlatness, float zeroCrossRate);
+    void scanPeakAhead(int numSamples, int lookAheadSamples);
+
+    static float speedToWindowMs(float speed) { return juce::jmap(speed, 0.0f, 100.0f, 100.0f, 10.0f); }
+
+    //==============================================================================
+    double sampleRate = 44100.0;
+    int maxBlockSize = 0;
+
+    RMSDetector rmsDetector;
+    PeakDetector peakDetector;
+    float lastSpeed = -1.0f;
+
+    // Detection filters (200Hz - 4kHz band, or the tighter vocal focus band)
+    juce::dsp::StateVariableTPTFilter<float> sidechainHPF;
+    juce::dsp::StateVariableTPTFilter<float> sidechainLPF;
+    juce::dsp::StateVariableTPTFilter<float> vocalFocusHighPass;  // Cut below ~180Hz
+    juce::dsp::StateVariableTPTFilter<float> vocalFocusLowPass;   // Cut above ~5kHz
+
+    // LUFS measurement (K-weighting approximation, ~3 s sliding window)
+    juce::dsp::StateVariableTPTFilter<float> lufsPreFilter;
+    juce::dsp::StateVariableTPTFilter<float> lufsHighShelf;
+    float lufsIntegrator = 0.0f;
+    int lufsSampleCount = 0;
+    float measuredLufs = -100.0f;
+
+    // Breath detection
+    bool isBreath = false;
+    float breathEnvelope = 0.0f;
+
+    // Per-block results (pre-allocated in prepare)
+    std::vector<float> filtered;
+    std::vector<float> rmsDb;
+    std::vector<float> peakDb;
+    std::vector<float> peakAheadDb;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RideDetector)
+};
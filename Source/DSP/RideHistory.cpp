@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    RideHistory.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RideHistory.h"
+#include "RideDetector.h"
+#include <algorithm>
+#include <cmath>
+
+void RideHistory::prepare(double newSampleRate, double seconds)
+{
+    const juce::ScopedLock sl(resizeLock);
+
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    const auto numFrames = static_cast<size_t>(juce::jmax(1.0, seconds * sampleRate / samplesPerFrame));
+
+    frames.assign(numFrames, Frame{});
+    framesWritten.store(0);
+
+    current = Frame{};
+    sumSquares = 0.0f;
+    frameSampleCount = 0;
+}
+
+//==============================================================================
+void RideHistory::push(const RideDetector& detector, int numSamples)
+{
+    if (frames.empty())
+        return;
+
+    const float* filtered = detector.getFilteredSamples();
+    const float* rms = detector.getRmsDb();
+    const float* peak = detector.getPeakDb();
+    const float* peakAhead = detector.getPeakAheadDb();
+
+    const auto capacity = static_cast<juce::int64>(frames.size());
+    auto written = framesWritten.load(std::memory_order_relaxed);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        sumSquares += filtered[i] * filtered[i];
+        current.peakDb = frameSampleCount == 0 ? peak[i] : juce::jmax(current.peakDb, peak[i]);
+        current.peakAheadDb = frameSampleCount == 0 ? peakAhead[i] : juce::jmax(current.peakAheadDb, peakAhead[i]);
+
+        if (++frameSampleCount == samplesPerFrame)
+        {
+            current.detectorRms = std::sqrt(sumSquares / static_cast<float>(samplesPerFrame));
+            current.rmsDb = rms[i];
+            current.lufs = detector.getLufs();
+            current.breath = detector.isBreathDetected();
+
+            frames[static_cast<size_t>(written % capacity)] = current;
+            framesWritten.store(++written, std::memory_order_release);
+
+            sumSquares = 0.0f;
+            frameSampleCount = 0;
+        }
+    }
+}
+
+bool RideHistory::copyLatest(std::vector<Frame>& dest, juce::int64& endFrame) const
+{
+    const juce::ScopedLock sl(resizeLock);
+
+    const auto capacity = static_cast<juce::int64>(frames.size());
+    const auto writtenBefore = framesWritten.load(std::memory_order_acquire);
+    if (capacity == 0 || writtenBefore == 0)
+        return false;
+
+    const auto first = juce::jmax(static_cast<juce::int64>(0), writtenBefore - capacity);
+    dest.resize(static_cast<size_t>(writtenBefore - first));
+
+    for (auto i = first; i < writtenBefore; ++i)
+        dest[static_cast<size_t>(i - first)] = frames[static_cast<size_t>(i % capacity)];
+
+    // Frames the audio thread wrapped over during the copy (plus the one it may
+    // be writing right now) can be torn - drop them
+    const auto writtenAfter = framesWritten.load(std::memory_order_acquire);
+    const auto overwritten = juce::jmin(static_cast<juce::int64>(dest.size()),
+                                        juce::jmax(static_cast<juce::int64>(0), writtenAfter + 1 - capacity - first));
+    if (overwritten > 0)
+        dest.erase(dest.begin(), dest.begin() + static_cast<std::ptrdiff_t>(overwritten));
+
+    endFrame = writtenBefore;
+    return !dest.empty();
+}
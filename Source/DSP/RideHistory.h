@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    RideHistory.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Compact ring of recent detector output (one frame per 16 samples) so the
+    ride decision can be re-run over the last few seconds with different
+    settings. Written by the audio thread without locking; readers copy a
+    snapshot and discard any frames that were overwritten while copying.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+#include <vector>
+
+class RideDetector;
+
+class RideHistory
+{
+public:
+    /** Detector data for one frame, in the form RideCore::processSample takes */
+    struct Frame
+    {
+        float detectorRms = 0.0f;       // RMS of the filtered input (keeps the phrase energy exact)
+        float rmsDb = -100.0f;          // RMS envelope at the end of the frame
+        float peakDb = -100.0f;         // Highest peak envelope in the frame
+        float peakAheadDb = -100.0f;    // Highest predictive peak in the frame
+        float lufs = -100.0f;           // Block LUFS the frame was part of
+        bool breath = false;            // Block breath flag
+    };
+
+    RideHistory() = default;
+
+    //==============================================================================
+    /** Allocates the ring (not real-time safe; call from prepareToPlay) */
+    void prepare(double sampleRate, double seconds);
+
+    /** Audio thread: appends one processed detector block. Never blocks or allocates. */
+    void push(const RideDetector& detector, int numSamples);
+
+    /** Copies the newest frames, oldest first, into dest (any thread).
+        endFrame receives the frame count the copy ends at (see getFramesWritten).
+        @returns false if nothing has been recorded yet
+    */
+    bool copyLatest(std::vector<Frame>& dest, juce::int64& endFrame) const;
+
+    /** Frames pushed since prepare(), for lining a snapshot up with later audio */
+    juce::int64 getFramesWritten() const { return framesWritten.load(std::memory_order_acquire); }
+
+    double getSampleRate() const { return sampleRate; }
+    double getFrameRate() const { return sampleRate / samplesPerFrame; }
+
+    static constexpr int samplesPerFrame = 16;
+
+private:
+    //==============================================================================
+    juce::CriticalSection resizeLock;     // prepare() vs. copyLatest() only
+    std::vector<Frame> frames;
+    std::atomic<juce::int64> framesWritten { 0 };
+    double sampleRate = 44100.0;
+
+    // Audio thread accumulators for the frame being built
+    Frame current;
+    float sumSquares = 0.0f;
+    int frameSampleCount = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RideHistory)
+};
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    RidePreviewRenderer.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RidePreviewRenderer.h"
+#include "RideCore.h"
+
+RidePreviewRenderer::RidePreviewRenderer(const RideHistory& h)
+    : juce::Thread("magic.RIDE Ride Preview"),
+      history(h)
+{
+}
+
+RidePreviewRenderer::~RidePreviewRenderer()
+{
+    signalThreadShouldExit();
+    notify();
+    stopThread(4000);
+}
+
+//==============================================================================
+void RidePreviewRenderer::requestPreview(const RideSettings& settings)
+{
+    {
+        const juce::ScopedLock sl(settingsLock);
+        pendingSettings = settings;
+    }
+
+    renderPending.store(true);
+
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::normal);
+
+    notify();
+}
+
+std::shared_ptr<const RidePreview> RidePreviewRenderer::getLatestPreview() const
+{
+    const juce::ScopedLock sl(previewLock);
+    return latestPreview;
+}
+
+//==============================================================================
+void RidePreviewRenderer::run()
+{
+    while (!threadShouldExit())
+    {
+        if (!renderPending.exchange(false))
+        {
+            wait(-1);
+            continue;
+        }
+
+        RideSettings settings;
+        {
+            const juce::ScopedLock sl(settingsLock);
+            settings = pendingSettings;
+        }
+
+        auto preview = std::make_shared<RidePreview>();
+        if (render(settings, *preview))
+        {
+            const juce::ScopedLock sl(previewLock);
+            preview->sequence = nextSequence++;
+            latestPreview = std::move(preview);
+        }
+    }
+}
+
+bool RidePreviewRenderer::render(const RideSettings& settings, RidePreview& preview)
+{
+    if (!history.copyLatest(frames, preview.endFrame))
+        return false;
+
+    // Same decision code the processor runs, from a clean state. Each frame is
+    // replayed at the full sample rate so the gate, phrase and smoother time
+    // constants are the live ones, but all 16 samples of a frame see the
+    // frame's averaged RMS and maximum peaks, so the curve approximates the
+    // live ride rather than reproducing it sample for sample.
+    RideCore core;
+    core.prepare(history.getSampleRate());
+    core.setSettings(settings);
+
+    const double frameRate = history.getFrameRate();
+    const auto numFrames = static_cast<int>(frames.size());
+    const int numShown = juce::jmin(numFrames, static_cast<int>(previewSeconds * frameRate));
+    const int firstShown = numFrames - numShown;
+
+    preview.frameRate = frameRate;
+    preview.gainDb.resize(static_cast<size_t>(numShown));
+
+    for (int f = 0; f < numFrames; ++f)
+    {
+        if ((f & 1023) == 0 && (threadShouldExit() || renderPending.load()))
+            return false;   // Superseded - the next request starts right away
+
+        const auto& frame = frames[static_cast<size_t>(f)];
+        core.setBlockAnalysis(frame.lufs, frame.breath);
+
+        float sum = 0.0f;
+        for (int i = 0; i < RideHistory::samplesPerFrame; ++i)
+            sum += core.processSample(frame.detectorRms, frame.rmsDb, frame.peakDb, frame.peakAheadDb);
+
+        if (f >= firstShown)
+            preview.gainDb[static_cast<size_t>(f - firstShown)] = sum / static_cast<float>(RideHistory::samplesPerFrame);
+    }
+
+    return true;
+}
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    RidePreviewRenderer.h
+    Created: 2026
+    Author:  MBM Audio
+
+    "What-if" ride preview. A background thread re-runs the ride decision
+    over the recent detector history (see RideHistory) with new settings, so
+    the waveform display can show what a target/range/speed change would
+    have done to the last few seconds without replaying them. The history is
+    decimated to one frame per 16 samples, so the preview is a close
+    approximation of the live ride, not a sample-exact replay.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "RideHistory.h"
+#include "RideSettings.h"
+
+//==============================================================================
+/** One finished preview: ride gain per history frame, newest last. */
+struct RidePreview
+{
+    std::vector<float> gainDb;
+    double frameRate = 44100.0 / RideHistory::samplesPerFrame;
+    juce::int64 endFrame = 0;       // History frame count the newest point ends at
+    int sequence = 0;
+
+    double getLengthSeconds() const { return static_cast<double>(gainDb.size()) / frameRate; }
+};
+
+//==============================================================================
+class RidePreviewRenderer : private juce::Thread
+{
+public:
+    explicit RidePreviewRenderer(const RideHistory& history);
+    ~RidePreviewRenderer() override;
+
+    //==============================================================================
+    /** Queues a re-render with these settings; a render still running is abandoned.
+        The worker thread is started by the first request, so instances whose
+        editor never asks for a preview don't run one. */
+    void requestPreview(const RideSettings& settings);
+
+    /** Latest finished preview, or nullptr before the first one (message thread) */
+    std::shared_ptr<const RidePreview> getLatestPreview() const;
+
+    // The history holds a little more than is shown so the ride state has
+    // settled by the time the visible part starts
+    static constexpr double previewSeconds = 8.0;
+    static constexpr double warmUpSeconds = 2.0;
+
+private:
+    //==============================================================================
+    void run() override;
+    bool render(const RideSettings& settings, RidePreview& preview);
+
+    const RideHistory& history;
+    std::vector<RideHistory::Frame> frames;     // Worker-side snapshot (reused)
+
+    juce::CriticalSection settingsLock;
+    RideSettings pendingSettings;
+    std::atomic<bool> renderPending { false };
+
+    mutable juce::CriticalSection previewLock;
+    std::shared_ptr<const RidePreview> latestPreview;
+    int nextSequence = 1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RidePreviewRenderer)
+};
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    RideSettings.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Plain snapshot of everything that shapes the ride. The processor fills one
+    per block from its parameters; offline renders take a copy from the
+    message thread so they can run without touching the processor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+struct RideSettings
+{
+    // Core ride
+    float targetDb = -18.0f;
+    float boostRangeDb = 6.0f;
+    float cutRangeDb = 6.0f;
+    float speed = 50.0f;                    // 0-100 %, drives the RMS window
+
+    // Advanced timing
+    float attackMs = 50.0f;
+    float releaseMs = 200.0f;
+    float holdMs = 0.0f;
+
+    // Detail controls
+    float breathReductionDb = 0.0f;         // 0 = off
+    float transientPreservation = 0.0f;     // 0.0 = off, 1.0 = full
+    float noiseFloorDb = -100.0f;           // <= -60 = off
+
+    bool naturalMode = true;
+    bool smartSilence = false;
+
+    // Detection front-end
+    bool vocalFocus = true;
+    bool useLufs = false;
+    bool useLookAhead = false;
+    int lookAheadSamples = 0;
+
+    /** Copies the user-facing ride controls (the ones A/B compare switches),
+        leaving the detection front-end settings untouched. */
+    void copyRideControlsFrom(const RideSettings& other)
+    {
+        targetDb = other.targetDb;
+        boostRangeDb = other.boostRangeDb;
+        cutRangeDb = other.cutRangeDb;
+        speed = other.speed;
+        attackMs = other.attackMs;
+        releaseMs = other.releaseMs;
+        holdMs = other.holdMs;
+        breathReductionDb = other.breathReductionDb;
+        transientPreservation = other.transientPreservation;
+        noiseFloorDb = other.noiseFloorDb;
+    }
+
+    bool operator== (const RideSettings& other) const
+    {
+        return targetDb == other.targetDb && boostRangeDb == other.boostRangeDb
+            && cutRangeDb == other.cutRangeDb && speed == other.speed
+            && attackMs == other.attackMs && releaseMs == other.releaseMs
+            && holdMs == other.holdMs && breathReductionDb == other.breathReductionDb
+            && transientPreservation == other.transientPreservation
+            && noiseFloorDb == other.noiseFloorDb && naturalMode == other.naturalMode
+            && smartSilence == other.smartSilence && vocalFocus == other.vocalFocus
+            && useLufs == other.useLufs && useLookAhead == other.useLookAhead
+            && lookAheadSamples == other.lookAheadSamples;
+    }
+
+    bool operator!= (const RideSettings& other) const { return !(*this == other); }
+};
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    RideStageAnalyzer.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RideStageAnalyzer.h"
+
+RideStageAnalyzer::RideStageAnalyzer(double newSampleRate, const RideSettings& newSettings)
+    : sampleRate(newSampleRate), settings(newSettings)
+{
+    mono.resize(static_cast<size_t>(blockSize), 0.0f);
+    detector.prepare(sampleRate, blockSize, settings.speed);
+    core.prepare(sampleRate);
+    core.setSettings(settings);
+}
+
+void RideStageAnalyzer::reset()
+{
+    detector.reset();
+    detector.resetLufs();
+    core.reset();
+}
+
+//==============================================================================
+void RideStageAnalyzer::process(const float* audio, int numChannels, int numSamples,
+                                std::ptrdiff_t sampleStride, std::ptrdiff_t channelStride,
+                                const RideStageOutputs& outputs)
+{
+    if (audio == nullptr || numChannels <= 0)
+        return;
+
+    const float channelScale = 1.0f / static_cast<float>(numChannels);
+
+    for (int blockStart = 0; blockStart < numSamples; blockStart += blockSize)
+    {
+        const int count = juce::jmin(blockSize, numSamples - blockStart);
+        const float* blockAudio = audio + blockStart * sampleStride;
+
+        // Contiguous mono goes straight to the detector; everything else is mixed down
+        const float* detectorInput = blockAudio;
+        if (numChannels > 1 || sampleStride != 1)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                float sum = 0.0f;
+                for (int ch = 0; ch < numChannels; ++ch)
+                    sum += blockAudio[i * sampleStride + ch * channelStride];
+                mono[static_cast<size_t>(i)] = sum * channelScale;
+            }
+            detectorInput = mono.data();
+        }
+
+        detector.process(detectorInput, count, settings);
+        core.setBlockAnalysis(detector.getLufs(), detector.isBreathDetected());
+
+        const float* filtered = detector.getFilteredSamples();
+        const float* rms = detector.getRmsDb();
+        const float* peak = detector.getPeakDb();
+        const float* peakAhead = detector.getPeakAheadDb();
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int n = blockStart + i;
+            const float gainDb = core.processSample(filtered[i], rms[i], peak[i], peakAhead[i]);
+
+            if (outputs.rmsDb != nullptr)        outputs.rmsDb[n] = rms[i];
+            if (outputs.peakDb != nullptr)       outputs.peakDb[n] = peak[i];
+            if (outputs.peakAheadDb != nullptr)  outputs.peakAheadDb[n] = peakAhead[i];
+            if (outputs.gateOpen != nullptr)     outputs.gateOpen[n] = core.isGateOpen() ? 1 : 0;
+            if (outputs.inPhrase != nullptr)     outputs.inPhrase[n] = core.isInPhrase() ? 1 : 0;
+            if (outputs.targetGainDb != nullptr) outputs.targetGainDb[n] = core.getTargetGainDb();
+            if (outputs.gainDb != nullptr)       outputs.gainDb[n] = gainDb;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    RideStageAnalyzer.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Runs the ride (RideDetector + RideCore, exactly as the processor does)
+    over caller-owned audio and writes every stage's per-sample output into
+    caller-owned arrays: detector levels, gate and phrase state, the
+    unsmoothed target gain and the smoothed gain. Input may be strided in
+    any layout, so bindings can pass their arrays straight through.
+
+    Holds no global state; one analyzer per file/thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "RideDetector.h"
+#include "RideCore.h"
+#include "RideSettings.h"
+
+/** Per-sample outputs of each ride stage. Leave a pointer null to skip that output. */
+struct RideStageOutputs
+{
+    float* rmsDb = nullptr;             // Detector RMS envelope
+    float* peakDb = nullptr;            // Detector peak envelope
+    float* peakAheadDb = nullptr;       // Predictive peak (-100 when look-ahead is off)
+    std::uint8_t* gateOpen = nullptr;   // 1 while the noise gate is open
+    std::uint8_t* inPhrase = nullptr;   // 1 inside a Natural-mode phrase
+    float* targetGainDb = nullptr;      // Gain decision before the smoother
+    float* gainDb = nullptr;            // Smoothed gain (what the processor applies)
+};
+
+class RideStageAnalyzer
+{
+public:
+    /** Same block size the offline renders use */
+    static constexpr int blockSize = 512;
+
+    RideStageAnalyzer(double sampleRate, const RideSettings& settings);
+
+    /** Back to a clean state (e.g. before the next file) */
+    void reset();
+
+    const RideSettings& getSettings() const { return settings; }
+    double getSampleRate() const { return sampleRate; }
+
+    //==============================================================================
+    /** Analyses the next numSamples samples; state carries over between calls.
+        Multi-channel input is averaged to mono like the processor's detector feed.
+        @param audio          First sample of the first channel
+        @param sampleStride   Distance between consecutive samples, in floats
+        @param channelStride  Distance between channels, in floats
+        @param outputs        Arrays of at least numSamples, written from index 0
+    */
+    void process(const float* audio, int numChannels, int numSamples,
+                 std::ptrdiff_t sampleStride, std::ptrdiff_t channelStride,
+                 const RideStageOutputs& outputs);
+
+private:
+    //==============================================================================
+    double sampleRate;
+    RideSettings settings;
+
+    RideDetector detector;
+    RideCore core;
+    std::vector<float> mono;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RideStageAnalyzer)
+};
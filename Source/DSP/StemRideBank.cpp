@@ -0,0 +1,298 @@
+/*
+  ==============================================================================
+
+    StemRideBank.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "StemRideBank.h"
+#include <algorithm>
+#include <cmath>
+
+void StemRideBank::SvfCoefficients::set(double cutoffHz, double sr)
+{
+    // Same topology as juce::dsp::StateVariableTPTFilter (Butterworth Q)
+    g = static_cast<float>(std::tan(juce::MathConstants<double>::pi * cutoffHz / sr));
+    r2 = juce::MathConstants<float>::sqrt2;
+    h = 1.0f / (1.0f + r2 * g + g * g);
+}
+
+StemRideBank::StemRideBank()
+{
+    for (auto& gain : publishedGainDb)
+        gain.store(0.0f);
+
+    targetDb.fill(-18.0f);
+    rangeDb.fill(6.0f);
+    reset();
+}
+
+//==============================================================================
+void StemRideBank::prepare(double newSampleRate, int newMaxBlockSize)
+{
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    maxBlockSize = juce::jmax(1, newMaxBlockSize);
+
+    // Detection band matches RideDetector's standard 200 Hz - 4 kHz focus
+    highPass.set(200.0, sampleRate);
+    lowPass.set(juce::jmin(4000.0, sampleRate * 0.45), sampleRate);
+    peakReleaseCoeff = std::exp(-1.0f / (50.0f * 0.001f * static_cast<float>(sampleRate)));
+    updateSpeedCoefficients();
+
+    // Room to align the first frame to the SIMD width
+    interleavedStorage.assign(static_cast<size_t>(maxBlockSize * maxStems + lanes), 0.0f);
+    interleaved = SIMDFloat::getNextSIMDAlignedPtr(interleavedStorage.data());
+
+    reset();
+}
+
+void StemRideBank::reset()
+{
+    const auto zero = SIMDFloat::expand(0.0f);
+    const auto unity = SIMDFloat::expand(1.0f);
+
+    for (int g = 0; g < numGroups; ++g)
+    {
+        const auto idx = static_cast<size_t>(g);
+        hpS1[idx] = hpS2[idx] = lpS1[idx] = lpS2[idx] = zero;
+        meanSquare[idx] = peak[idx] = zero;
+        smoothedGainDb[idx] = zero;
+        gainLinear[idx] = unity;
+        gainStep[idx] = zero;
+    }
+
+    gateOpen.fill(false);
+}
+
+void StemRideBank::setStemTarget(int stem, float newTargetDb)
+{
+    if (juce::isPositiveAndBelow(stem, maxStems))
+        targetDb[static_cast<size_t>(stem)] = newTargetDb;
+}
+
+void StemRideBank::setStemRange(int stem, float newRangeDb)
+{
+    if (juce::isPositiveAndBelow(stem, maxStems))
+        rangeDb[static_cast<size_t>(stem)] = juce::jmax(0.0f, newRangeDb);
+}
+
+void StemRideBank::setSpeed(float newSpeed)
+{
+    newSpeed = juce::jlimit(0.0f, 100.0f, newSpeed);
+    if (std::abs(newSpeed - speed) < 0.01f)
+        return;
+
+    speed = newSpeed;
+    updateSpeedCoefficients();
+}
+
+void StemRideBank::updateSpeedCoefficients()
+{
+    const float sr = static_cast<float>(sampleRate);
+
+    // RMS window as in RideDetector, attack/release as in updateAttackReleaseFromSpeed()
+    const float windowMs = juce::jmap(speed, 0.0f, 100.0f, 100.0f, 10.0f);
+    meanSquareCoeff = 1.0f - std::exp(-1.0f / (windowMs * 0.001f * sr));
+
+    const float speedFactor = std::sqrt(speed / 100.0f);
+    attackMs = juce::jmap(speedFactor, 500.0f, 5.0f);
+    releaseMs = juce::jmap(speedFactor, 1000.0f, 20.0f);
+}
+
+float StemRideBank::getStemGainDb(int stem) const
+{
+    return juce::isPositiveAndBelow(stem, maxStems) ? publishedGainDb[static_cast<size_t>(stem)].load() : 0.0f;
+}
+
+//==============================================================================
+void StemRideBank::process(const StemChannels* stems, int numStems, int numSamples)
+{
+    if (numSamples <= 0 || interleaved == nullptr)
+        return;
+
+    numStems = juce::jmin(numStems, maxStems);
+
+    // Hosts can exceed the prepared size (offline bounces, some first blocks):
+    // ride those in prepared-size chunks instead of passing them through
+    std::array<StemChannels, maxStems> chunk {};
+    for (int start = 0; start < numSamples; start += maxBlockSize)
+    {
+        for (int s = 0; s < numStems; ++s)
+        {
+            const auto& stem = stems[s];
+            auto& chunkStem = chunk[static_cast<size_t>(s)];
+            chunkStem.left = stem.left != nullptr ? stem.left + start : nullptr;
+            chunkStem.right = stem.right != nullptr ? stem.right + start : nullptr;
+        }
+
+        processChunk(chunk.data(), numStems, juce::jmin(maxBlockSize, numSamples - start));
+    }
+}
+
+void StemRideBank::processChunk(const StemChannels* stems, int numStems, int numSamples)
+{
+    // Gather each stem's mono detector input into its lane; unused lanes stay silent
+    std::fill(interleaved, interleaved + numSamples * maxStems, 0.0f);
+    for (int s = 0; s < numStems; ++s)
+    {
+        const auto& stem = stems[s];
+        if (stem.left == nullptr)
+            continue;
+
+        float* lane = interleaved + s;
+        if (stem.right != nullptr)
+            for (int i = 0; i < numSamples; ++i)
+                lane[i * maxStems] = 0.5f * (stem.left[i] + stem.right[i]);
+        else
+            for (int i = 0; i < numSamples; ++i)
+                lane[i * maxStems] = stem.left[i];
+    }
+
+    const auto hpG = SIMDFloat::expand(highPass.g);
+    const auto hpGR = SIMDFloat::expand(highPass.g + highPass.r2);
+    const auto hpH = SIMDFloat::expand(highPass.h);
+    const auto lpG = SIMDFloat::expand(lowPass.g);
+    const auto lpGR = SIMDFloat::expand(lowPass.g + lowPass.r2);
+    const auto lpH = SIMDFloat::expand(lowPass.h);
+    const auto msCoeff = SIMDFloat::expand(meanSquareCoeff);
+    const auto pkRelease = SIMDFloat::expand(peakReleaseCoeff);
+    const auto zero = SIMDFloat::expand(0.0f);
+
+    for (int start = 0; start < numSamples; start += controlInterval)
+    {
+        const int count = juce::jmin(controlInterval, numSamples - start);
+        updateControl(count);
+
+        for (int i = start; i < start + count; ++i)
+        {
+            float* frame = interleaved + i * maxStems;
+
+            for (int g = 0; g < numGroups; ++g)
+            {
+                const auto idx = static_cast<size_t>(g);
+                auto x = SIMDFloat::fromRawArray(frame + g * lanes);
+
+                // High-pass, then low-pass (TPT SVF, one lane per stem)
+                auto hp = hpH * (x - hpS1[idx] * hpGR - hpS2[idx]);
+                auto bp = hp * hpG + hpS1[idx];
+                hpS1[idx] = hp * hpG + bp;
+                hpS2[idx] = bp * hpG + (bp * hpG + hpS2[idx]);
+
+                auto hp2 = lpH * (hp - lpS1[idx] * lpGR - lpS2[idx]);
+                auto bp2 = hp2 * lpG + lpS1[idx];
+                auto y = bp2 * lpG + lpS2[idx];
+                lpS1[idx] = hp2 * lpG + bp2;
+                lpS2[idx] = bp2 * lpG + y;
+
+                // RMS (exponential window) and peak envelopes
+                meanSquare[idx] = meanSquare[idx] + msCoeff * (y * y - meanSquare[idx]);
+                peak[idx] = SIMDFloat::max(SIMDFloat::max(y, zero - y), peak[idx] * pkRelease);
+
+                // Gain ramp towards the control-rate target; written back over the input
+                gainLinear[idx] = gainLinear[idx] + gainStep[idx];
+                gainLinear[idx].copyToRawArray(frame + g * lanes);
+            }
+        }
+    }
+
+    // Apply each stem's gain lane to its channels
+    for (int s = 0; s < numStems; ++s)
+    {
+        const auto& stem = stems[s];
+        if (stem.left == nullptr)
+            continue;
+
+        const float* lane = interleaved + s;
+        for (int i = 0; i < numSamples; ++i)
+            stem.left[i] *= lane[i * maxStems];
+
+        if (stem.right != nullptr)
+            for (int i = 0; i < numSamples; ++i)
+                stem.right[i] *= lane[i * maxStems];
+    }
+
+    for (int s = 0; s < maxStems; ++s)
+        publishedGainDb[static_cast<size_t>(s)].store(smoothedGainDb[static_cast<size_t>(s / lanes)].get(static_cast<size_t>(s % lanes)));
+}
+
+//==============================================================================
+void StemRideBank::updateControl(int numSamples)
+{
+    // Gain decision needs logs, so it runs per stem at control rate
+    std::array<float, maxStems> targetGainDb {};
+    for (int s = 0; s < maxStems; ++s)
+    {
+        const auto g = static_cast<size_t>(s / lanes);
+        const auto lane = static_cast<size_t>(s % lanes);
+
+        const float rmsDb = 10.0f * std::log10(juce::jmax(meanSquare[g].get(lane), 1.0e-10f));
+        const float peakDb = juce::Decibels::gainToDecibels(peak[g].get(lane), -100.0f);
+        targetGainDb[static_cast<size_t>(s)] = computeTargetGainDb(s, rmsDb, peakDb);
+    }
+
+    // Attack for rising gain, release for falling gain, over this control period
+    const float samplesPerMs = static_cast<float>(sampleRate) * 0.001f;
+    const auto attack = SIMDFloat::expand(1.0f - std::exp(-static_cast<float>(numSamples) / (attackMs * samplesPerMs)));
+    const auto release = SIMDFloat::expand(1.0f - std::exp(-static_cast<float>(numSamples) / (releaseMs * samplesPerMs)));
+    const auto invCount = SIMDFloat::expand(1.0f / static_cast<float>(numSamples));
+
+    for (int g = 0; g < numGroups; ++g)
+    {
+        const auto idx = static_cast<size_t>(g);
+
+        auto target = SIMDFloat::expand(0.0f);
+        for (int lane = 0; lane < lanes; ++lane)
+            target.set(static_cast<size_t>(lane), targetGainDb[static_cast<size_t>(g * lanes + lane)]);
+
+        const auto rising = SIMDFloat::greaterThan(target, smoothedGainDb[idx]);
+        const auto alpha = (attack & rising) + (release & ~rising);
+        smoothedGainDb[idx] = smoothedGainDb[idx] + alpha * (target - smoothedGainDb[idx]);
+
+        // Linear ramp to the new gain across the period (no per-sample exp)
+        auto nextLinear = SIMDFloat::expand(1.0f);
+        for (int lane = 0; lane < lanes; ++lane)
+            nextLinear.set(static_cast<size_t>(lane),
+                           juce::Decibels::decibelsToGain(smoothedGainDb[idx].get(static_cast<size_t>(lane))));
+
+        gainStep[idx] = (nextLinear - gainLinear[idx]) * invCount;
+    }
+}
+
+float StemRideBank::computeTargetGainDb(int stem, float rmsDb, float peakDb)
+{
+    const auto s = static_cast<size_t>(stem);
+
+    // Gate with hysteresis (don't boost silence)
+    if (!gateOpen[s] && rmsDb > gateThresholdDb + gateHysteresisDb)
+        gateOpen[s] = true;
+    else if (gateOpen[s] && rmsDb < gateThresholdDb)
+        gateOpen[s] = false;
+
+    // Blend peak and RMS for transient sensitivity
+    float effectiveLevelDb = rmsDb;
+    if (peakDb > rmsDb + 3.0f)
+        effectiveLevelDb = rmsDb + (peakDb - rmsDb) * 0.7f;
+
+    float gainDb = targetDb[s] - effectiveLevelDb;
+
+    // Soft knee
+    if (std::abs(gainDb) < kneeWidthDb)
+    {
+        const float ratio = gainDb / kneeWidthDb;
+        gainDb = gainDb * (0.5f + 0.5f * ratio * ratio * (gainDb > 0 ? 1.0f : -1.0f));
+    }
+
+    gainDb = juce::jlimit(-rangeDb[s], rangeDb[s], gainDb);
+
+    // Keep boosted peaks below the ceiling
+    if (gainDb > 0.0f && peakDb + gainDb > peakSafeCeilingDb)
+        gainDb = juce::jmax(0.0f, peakSafeCeilingDb - peakDb);
+
+    if (!gateOpen[s] || effectiveLevelDb < gateThresholdDb - 10.0f)
+        gainDb = juce::jmin(gainDb, 0.0f);
+
+    return gainDb;
+}
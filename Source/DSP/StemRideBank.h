@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    StemRideBank.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Rides up to 8 stems at once for the multi-stem processor. All detection
+    and smoothing state is stored structure-of-arrays, one SIMD register per
+    group of stems, so every stem advances in its own lane of the same
+    instructions: the detection band-pass, RMS/peak envelopes and the gain
+    ramp all run once per sample for all stems. The gain decision (which
+    needs logs) runs per stem at control rate, every 32 samples.
+
+    The decision matches RideCore's Standard mode (peak/RMS blend, soft knee,
+    range clamp, peak-safe boost, gate). Each stem has its own target and
+    range; speed is shared.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+class StemRideBank
+{
+public:
+    static constexpr int maxStems = 8;
+
+    /** One stem's audio, processed in place. right is null for a mono stem. */
+    struct StemChannels
+    {
+        float* left = nullptr;
+        float* right = nullptr;
+    };
+
+    StemRideBank();
+
+    //==============================================================================
+    void prepare(double sampleRate, int maxBlockSize);
+    void reset();
+
+    void setStemTarget(int stem, float targetDb);
+    void setStemRange(int stem, float rangeDb);
+
+    /** Shared speed (0-100): sets the RMS window and attack/release for every stem */
+    void setSpeed(float speed);
+
+    //==============================================================================
+    /** Rides numStems stems in place. Stems without channels are left untouched.
+        Blocks larger than the prepared size are ridden in prepared-size chunks.
+    */
+    void process(const StemChannels* stems, int numStems, int numSamples);
+
+    /** Smoothed ride gain of a stem at the end of the last block (any thread) */
+    float getStemGainDb(int stem) const;
+
+    // Gate and peak-safe limits (same as RideCore)
+    static constexpr float gateThresholdDb = -45.0f;
+    static constexpr float gateHysteresisDb = 3.0f;
+    static constexpr float kneeWidthDb = 6.0f;
+    static constexpr float peakSafeCeilingDb = -1.0f;
+
+private:
+    //==============================================================================
+    using SIMDFloat = juce::dsp::SIMDRegister<float>;
+    static constexpr int lanes = static_cast<int>(SIMDFloat::SIMDNumElements);
+    static constexpr int numGroups = (maxStems + lanes - 1) / lanes;
+    static constexpr int controlInterval = 32;
+
+    static_assert(maxStems % lanes == 0, "Stems must fill whole SIMD registers");
+
+    /** process() for at most maxBlockSize samples */
+    void processChunk(const StemChannels* stems, int numStems, int numSamples);
+
+    /** Per-stem gain decision from the current envelopes, then the dB smoother and
+        the linear gain ramp for the next numSamples samples */
+    void updateControl(int numSamples);
+    void updateSpeedCoefficients();
+    float computeTargetGainDb(int stem, float rmsDb, float peakDb);
+
+    /** Coefficients for a 2nd-order TPT state-variable filter (shared by all lanes) */
+    struct SvfCoefficients
+    {
+        float g = 0.0f, r2 = 0.0f, h = 0.0f;
+        void set(double cutoffHz, double sampleRate);
+    };
+
+    //==============================================================================
+    double sampleRate = 44100.0;
+    int maxBlockSize = 0;
+
+    SvfCoefficients highPass, lowPass;
+    float speed = 50.0f;
+    float meanSquareCoeff = 0.0f;
+    float peakReleaseCoeff = 0.0f;
+    float attackMs = 50.0f;
+    float releaseMs = 200.0f;
+
+    // Detection and ramp state, one register per stem group (SoA)
+    std::array<SIMDFloat, numGroups> hpS1, hpS2, lpS1, lpS2;
+    std::array<SIMDFloat, numGroups> meanSquare, peak;
+    std::array<SIMDFloat, numGroups> smoothedGainDb;
+    std::array<SIMDFloat, numGroups> gainLinear, gainStep;
+
+    // Control-rate, per stem
+    std::array<float, maxStems> targetDb {};
+    std::array<float, maxStems> rangeDb {};
+    std::array<bool, maxStems> gateOpen {};
+    std::array<std::atomic<float>, maxStems> publishedGainDb;
+
+    // Interleaved scratch: frame i holds one value per stem (SIMD aligned). Detector
+    // input on the way in, per-sample linear gain on the way out.
+    std::vector<float> interleavedStorage;
+    float* interleaved = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StemRideBank)
+};
@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    GainCurveFormat.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Layout of the ".ride" gain-curve sidecar. The file is designed to be
+    memory-mapped: every field sits at a fixed offset and any point of the
+    curve can be decoded in O(1) without scanning.
+
+    All values are little-endian.
+
+    Header (128 bytes)
+      0   char[4]  magic "MRGC"
+      4   uint32   format version
+      8   uint32   header size in bytes (128)
+      12  uint32   samples per point (curve resolution)
+      16  float64  sample rate
+      24  uint64   length in samples
+      32  uint64   number of points
+      40  uint32   points per block
+      44  uint32   number of blocks
+      48  float32  quantisation step in dB
+      52  uint32   reserved (0)
+      56  uint64   block index offset
+      64  char[64] preset name, UTF-8, zero padded
+
+    Block index (16 bytes per block)
+      0   int32    block base (quantised minimum of the block)
+      4   uint32   delta width in bytes (1 or 2)
+      8   uint64   absolute offset of the block's deltas
+
+    Block data
+      One unsigned delta per point. Point i of a block decodes to
+      (base + delta[i]) * step dB. Smooth rides fit in 1 byte per point.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace GainCurveFormat
+{
+    static constexpr const char* magic = "MRGC";
+    static constexpr juce::uint32 version = 1;
+    static constexpr const char* fileExtension = ".ride";
+
+    static constexpr int headerSize = 128;
+    static constexpr int blockIndexEntrySize = 16;
+    static constexpr int presetNameSize = 64;
+
+    // Header field offsets
+    static constexpr int versionOffset = 4;
+    static constexpr int headerSizeOffset = 8;
+    static constexpr int samplesPerPointOffset = 12;
+    static constexpr int sampleRateOffset = 16;
+    static constexpr int lengthOffset = 24;
+    static constexpr int numPointsOffset = 32;
+    static constexpr int pointsPerBlockOffset = 40;
+    static constexpr int numBlocksOffset = 44;
+    static constexpr int stepDbOffset = 48;
+    static constexpr int blockIndexOffsetOffset = 56;
+    static constexpr int presetNameOffset = 64;
+
+    static constexpr int defaultSamplesPerPoint = 64;   // ~1.3 ms at 48 kHz
+    static constexpr int defaultPointsPerBlock = 256;
+    static constexpr float defaultStepDb = 1.0f / 256.0f;
+
+    // Gains are clamped to this range before quantising
+    static constexpr float minGainDb = -96.0f;
+    static constexpr float maxGainDb = 96.0f;
+}
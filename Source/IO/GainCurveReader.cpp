@@ -0,0 +1,209 @@
+/*
+  ==============================================================================
+
+    GainCurveReader.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "GainCurveReader.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    juce::uint32 readUInt32(const juce::uint8* p) { return juce::ByteOrder::littleEndianInt(p); }
+    juce::int64 readInt64(const juce::uint8* p) { return static_cast<juce::int64>(juce::ByteOrder::littleEndianInt64(p)); }
+
+    float readFloat(const juce::uint8* p)
+    {
+        auto bits = readUInt32(p);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double readDouble(const juce::uint8* p)
+    {
+        auto bits = juce::ByteOrder::littleEndianInt64(p);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+GainCurveReader::GainCurveReader(const juce::File& file)
+{
+    using namespace GainCurveFormat;
+
+    mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    data = static_cast<const juce::uint8*>(mappedFile->getData());
+    dataSize = static_cast<juce::int64>(mappedFile->getSize());
+
+    if (data == nullptr)
+    {
+        fail("Could not open " + file.getFileName());
+        return;
+    }
+
+    if (dataSize < headerSize || std::memcmp(data, magic, 4) != 0)
+    {
+        fail(file.getFileName() + " is not a magic.RIDE gain curve");
+        return;
+    }
+
+    fileVersion = readUInt32(data + versionOffset);
+    if (fileVersion == 0 || fileVersion > version)
+    {
+        fail(file.getFileName() + " was written by a newer version (format " + juce::String(fileVersion) + ")");
+        return;
+    }
+
+    samplesPerPoint = static_cast<int>(readUInt32(data + samplesPerPointOffset));
+    sampleRate = readDouble(data + sampleRateOffset);
+    lengthInSamples = readInt64(data + lengthOffset);
+    numPoints = readInt64(data + numPointsOffset);
+    pointsPerBlock = static_cast<int>(readUInt32(data + pointsPerBlockOffset));
+    numBlocks = static_cast<int>(readUInt32(data + numBlocksOffset));
+    stepDb = readFloat(data + stepDbOffset);
+    blockIndexOffset = readInt64(data + blockIndexOffsetOffset);
+    presetName = juce::String::fromUTF8(reinterpret_cast<const char*>(data + presetNameOffset),
+                                        static_cast<int>(strnlen(reinterpret_cast<const char*>(data + presetNameOffset),
+                                                                 presetNameSize)));
+
+    if (samplesPerPoint <= 0 || pointsPerBlock <= 0 || sampleRate <= 0.0 || numPoints < 0
+        || numBlocks != static_cast<int>((numPoints + pointsPerBlock - 1) / pointsPerBlock))
+    {
+        fail(file.getFileName() + " has an invalid header");
+        return;
+    }
+
+    // Validate the whole index once so the accessors never need bounds checks
+    if (blockIndexOffset < headerSize
+        || blockIndexOffset + static_cast<juce::int64>(numBlocks) * blockIndexEntrySize > dataSize)
+    {
+        fail(file.getFileName() + " is truncated");
+        return;
+    }
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        auto* entry = getBlockIndexEntry(b);
+        const auto width = readUInt32(entry + 4);
+        const auto offset = readInt64(entry + 8);
+        const auto pointsInBlock = juce::jmin(static_cast<juce::int64>(pointsPerBlock),
+                                              numPoints - static_cast<juce::int64>(b) * pointsPerBlock);
+
+        if ((width != 1 && width != 2) || offset < 0 || offset + pointsInBlock * width > dataSize)
+        {
+            fail(file.getFileName() + " is truncated");
+            return;
+        }
+    }
+
+    valid = true;
+}
+
+void GainCurveReader::fail(const juce::String& message)
+{
+    error = message;
+    valid = false;
+}
+
+const juce::uint8* GainCurveReader::getBlockIndexEntry(juce::int64 block) const
+{
+    return data + blockIndexOffset + block * GainCurveFormat::blockIndexEntrySize;
+}
+
+//==============================================================================
+float GainCurveReader::getPointDb(juce::int64 pointIndex) const
+{
+    if (!valid || numPoints == 0)
+        return 0.0f;
+
+    pointIndex = juce::jlimit(static_cast<juce::int64>(0), numPoints - 1, pointIndex);
+
+    const auto block = pointIndex / pointsPerBlock;
+    const auto indexInBlock = pointIndex - block * pointsPerBlock;
+
+    auto* entry = getBlockIndexEntry(block);
+    const auto base = static_cast<int>(readUInt32(entry));
+    const auto width = readUInt32(entry + 4);
+    auto* deltas = data + readInt64(entry + 8);
+
+    const int delta = width == 1 ? static_cast<int>(deltas[indexInBlock])
+                                 : static_cast<int>(juce::ByteOrder::littleEndianShort(deltas + indexInBlock * 2));
+
+    return static_cast<float>(base + delta) * stepDb;
+}
+
+float GainCurveReader::getGainDbAtSample(juce::int64 samplePosition) const
+{
+    // Each point is the mean of its samples, so it best represents its centre
+    const double position = (static_cast<double>(samplePosition) + 0.5) / samplesPerPoint - 0.5;
+    const auto index = static_cast<juce::int64>(std::floor(position));
+    const auto frac = static_cast<float>(position - static_cast<double>(index));
+
+    const float a = getPointDb(index);
+    const float b = getPointDb(index + 1);
+    return a + (b - a) * frac;
+}
+
+//==============================================================================
+bool GainCurveReader::exportCsv(const juce::File& destination) const
+{
+    if (!valid)
+        return false;
+
+    destination.deleteFile();
+    juce::FileOutputStream out(destination);
+    if (!out.openedOk())
+        return false;
+
+    out << "time_s,gain_db\n";
+
+    const double secondsPerPoint = samplesPerPoint / sampleRate;
+    for (juce::int64 i = 0; i < numPoints; ++i)
+        out << juce::String(static_cast<double>(i) * secondsPerPoint, 6) << ","
+            << juce::String(getPointDb(i), 3) << "\n";
+
+    out.flush();
+    return !out.getStatus().failed();
+}
+
+bool GainCurveReader::exportJson(const juce::File& destination) const
+{
+    if (!valid)
+        return false;
+
+    destination.deleteFile();
+    juce::FileOutputStream out(destination);
+    if (!out.openedOk())
+        return false;
+
+    // Streamed by hand - building a juce::var for millions of points would be wasteful
+    out << "{\n"
+        << "  \"format\": \"magic.RIDE gain curve\",\n"
+        << "  \"version\": " << static_cast<int>(fileVersion) << ",\n"
+        << "  \"preset\": " << juce::JSON::toString(juce::var(presetName)) << ",\n"
+        << "  \"sampleRate\": " << sampleRate << ",\n"
+        << "  \"lengthInSamples\": " << lengthInSamples << ",\n"
+        << "  \"samplesPerPoint\": " << samplesPerPoint << ",\n"
+        << "  \"gainDb\": [";
+
+    for (juce::int64 i = 0; i < numPoints; ++i)
+    {
+        if (i > 0)
+            out << ",";
+        if (i % 16 == 0)
+            out << "\n    ";
+        out << juce::String(getPointDb(i), 3);
+    }
+
+    out << "\n  ]\n}\n";
+
+    out.flush();
+    return !out.getStatus().failed();
+}
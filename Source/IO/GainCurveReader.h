@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    GainCurveReader.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Memory-maps a ".ride" gain-curve sidecar (see GainCurveFormat.h) and
+    decodes any point in O(1). The CSV and JSON exporters are built on top
+    of the same accessors, so every consumer sees identical values.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <memory>
+#include "GainCurveFormat.h"
+
+class GainCurveReader
+{
+public:
+    explicit GainCurveReader(const juce::File& file);
+
+    //==============================================================================
+    /** False if the file is missing, truncated or not a supported sidecar */
+    bool isValid() const { return valid; }
+    juce::String getError() const { return error; }
+
+    juce::uint32 getVersion() const { return fileVersion; }
+    double getSampleRate() const { return sampleRate; }
+    int getSamplesPerPoint() const { return samplesPerPoint; }
+    juce::int64 getNumPoints() const { return numPoints; }
+    juce::int64 getLengthInSamples() const { return lengthInSamples; }
+    double getLengthInSeconds() const { return static_cast<double>(lengthInSamples) / sampleRate; }
+    juce::String getPresetName() const { return presetName; }
+
+    //==============================================================================
+    /** Gain of one stored point in dB (index is clamped to the valid range) */
+    float getPointDb(juce::int64 pointIndex) const;
+
+    /** Gain at any sample position, interpolated between the point centres */
+    float getGainDbAtSample(juce::int64 samplePosition) const;
+
+    //==============================================================================
+    /** One "time_s,gain_db" row per point */
+    bool exportCsv(const juce::File& destination) const;
+
+    /** Header fields plus a "gainDb" array with one value per point */
+    bool exportJson(const juce::File& destination) const;
+
+private:
+    //==============================================================================
+    const juce::uint8* getBlockIndexEntry(juce::int64 block) const;
+    void fail(const juce::String& message);
+
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    const juce::uint8* data = nullptr;
+    juce::int64 dataSize = 0;
+
+    bool valid = false;
+    juce::String error;
+
+    juce::uint32 fileVersion = 0;
+    double sampleRate = 44100.0;
+    int samplesPerPoint = 1;
+    juce::int64 lengthInSamples = 0;
+    juce::int64 numPoints = 0;
+    int pointsPerBlock = 1;
+    int numBlocks = 0;
+    float stepDb = GainCurveFormat::defaultStepDb;
+    juce::int64 blockIndexOffset = 0;
+    juce::String presetName;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainCurveReader)
+};
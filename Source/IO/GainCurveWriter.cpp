@@ -0,0 +1,177 @@
+/*
+  ==============================================================================
+
+    GainCurveWriter.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "GainCurveWriter.h"
+#include <algorithm>
+
+GainCurveWriter::GainCurveWriter(double sr, int spp, int ppb)
+    : sampleRate(sr > 0.0 ? sr : 44100.0),
+      samplesPerPoint(juce::jmax(1, spp)),
+      pointsPerBlock(juce::jmax(1, ppb))
+{
+}
+
+//==============================================================================
+void GainCurveWriter::addSamples(const float* gainDb, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        pointAccumulator += gainDb[i];
+
+        if (++pointSampleCount == samplesPerPoint)
+        {
+            points.push_back(static_cast<float>(pointAccumulator / samplesPerPoint));
+            pointAccumulator = 0.0;
+            pointSampleCount = 0;
+        }
+    }
+
+    lengthInSamples += numSamples;
+}
+
+bool GainCurveWriter::writeTo(const juce::File& file, juce::String& error) const
+{
+    using namespace GainCurveFormat;
+
+    // Quantise all points, including the partial one at the end
+    std::vector<int> quantised;
+    quantised.reserve(points.size() + 1);
+
+    auto quantise = [](float db)
+    {
+        return juce::roundToInt(juce::jlimit(minGainDb, maxGainDb, db) / defaultStepDb);
+    };
+
+    for (auto db : points)
+        quantised.push_back(quantise(db));
+
+    if (pointSampleCount > 0)
+        quantised.push_back(quantise(static_cast<float>(pointAccumulator / pointSampleCount)));
+
+    const auto numPoints = static_cast<juce::int64>(quantised.size());
+    const auto numBlocks = static_cast<int>((numPoints + pointsPerBlock - 1) / pointsPerBlock);
+
+    // Per-block base and delta width
+    std::vector<int> blockBase(static_cast<size_t>(numBlocks), 0);
+    std::vector<int> blockWidth(static_cast<size_t>(numBlocks), 1);
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        auto start = quantised.begin() + static_cast<std::ptrdiff_t>(b) * pointsPerBlock;
+        auto end = quantised.begin() + juce::jmin(static_cast<std::ptrdiff_t>(numPoints),
+                                                  static_cast<std::ptrdiff_t>(b + 1) * pointsPerBlock);
+        auto [minIt, maxIt] = std::minmax_element(start, end);
+        blockBase[static_cast<size_t>(b)] = *minIt;
+        blockWidth[static_cast<size_t>(b)] = (*maxIt - *minIt) <= 0xff ? 1 : 2;
+    }
+
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+        {
+            error = "Could not write " + file.getFullPathName();
+            return false;
+        }
+
+        // Header
+        const juce::int64 blockIndexOffset = headerSize;
+        out.write(magic, 4);
+        out.writeInt(static_cast<int>(version));
+        out.writeInt(headerSize);
+        out.writeInt(samplesPerPoint);
+        out.writeDouble(sampleRate);
+        out.writeInt64(lengthInSamples);
+        out.writeInt64(numPoints);
+        out.writeInt(pointsPerBlock);
+        out.writeInt(numBlocks);
+        out.writeFloat(defaultStepDb);
+        out.writeInt(0);
+        out.writeInt64(blockIndexOffset);
+
+        char name[presetNameSize] = {};
+        presetName.copyToUTF8(name, presetNameSize);   // Always zero terminated
+        out.write(name, presetNameSize);
+        jassert(out.getPosition() == headerSize);
+
+        // Block index
+        auto dataOffset = blockIndexOffset + static_cast<juce::int64>(numBlocks) * blockIndexEntrySize;
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            const auto pointsInBlock = juce::jmin(static_cast<juce::int64>(pointsPerBlock),
+                                                  numPoints - static_cast<juce::int64>(b) * pointsPerBlock);
+            out.writeInt(blockBase[static_cast<size_t>(b)]);
+            out.writeInt(blockWidth[static_cast<size_t>(b)]);
+            out.writeInt64(dataOffset);
+            dataOffset += pointsInBlock * blockWidth[static_cast<size_t>(b)];
+        }
+
+        // Block data
+        for (juce::int64 i = 0; i < numPoints; ++i)
+        {
+            const auto b = static_cast<size_t>(i / pointsPerBlock);
+            const auto delta = quantised[static_cast<size_t>(i)] - blockBase[b];
+
+            if (blockWidth[b] == 1)
+                out.writeByte(static_cast<char>(static_cast<juce::uint8>(delta)));
+            else
+                out.writeShort(static_cast<short>(static_cast<juce::uint16>(delta)));
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+        {
+            error = out.getStatus().getErrorMessage();
+            return false;
+        }
+    }
+
+    if (!temp.overwriteTargetFileWithTemporary())
+    {
+        error = "Could not replace " + file.getFullPathName();
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+bool GainCurveWriter::convertGainWav(const juce::File& gainWav,
+                                     const juce::File& destination,
+                                     const juce::String& presetName,
+                                     juce::String& error,
+                                     int samplesPerPoint)
+{
+    juce::WavAudioFormat wavFormat;
+    std::unique_ptr<juce::AudioFormatReader> reader(
+        wavFormat.createReaderFor(gainWav.createInputStream().release(), true));
+
+    if (reader == nullptr)
+    {
+        error = "Could not read " + gainWav.getFileName();
+        return false;
+    }
+
+    GainCurveWriter writer(reader->sampleRate, samplesPerPoint);
+    writer.setPresetName(presetName);
+
+    constexpr int chunkSize = 65536;
+    juce::AudioBuffer<float> chunk(1, chunkSize);
+
+    for (juce::int64 pos = 0; pos < reader->lengthInSamples; pos += chunkSize)
+    {
+        const auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(chunkSize),
+                                                            reader->lengthInSamples - pos));
+        reader->read(&chunk, 0, numSamples, pos, true, false);
+        writer.addSamples(chunk.getReadPointer(0), numSamples);
+    }
+
+    return writer.writeTo(destination, error);
+}
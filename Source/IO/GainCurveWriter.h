@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    GainCurveWriter.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Collects a per-sample gain curve (dB), reduces it to the sidecar's point
+    resolution and writes a ".ride" file (see GainCurveFormat.h).
+    Not for the audio thread - addSamples() may allocate.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <vector>
+#include "GainCurveFormat.h"
+
+class GainCurveWriter
+{
+public:
+    GainCurveWriter(double sampleRate,
+                    int samplesPerPoint = GainCurveFormat::defaultSamplesPerPoint,
+                    int pointsPerBlock = GainCurveFormat::defaultPointsPerBlock);
+
+    //==============================================================================
+    void setPresetName(const juce::String& name) { presetName = name; }
+
+    /** Appends gain values (dB per sample). Each point stores the mean of its samples. */
+    void addSamples(const float* gainDb, int numSamples);
+
+    /** Writes the sidecar, including any partially filled last point.
+        Writes to a temporary file first so readers never see half a file.
+    */
+    bool writeTo(const juce::File& file, juce::String& error) const;
+
+    juce::int64 getLengthInSamples() const { return lengthInSamples; }
+
+    //==============================================================================
+    /** Builds a sidecar from a recorded gain WAV (mono, dB per sample). */
+    static bool convertGainWav(const juce::File& gainWav,
+                               const juce::File& destination,
+                               const juce::String& presetName,
+                               juce::String& error,
+                               int samplesPerPoint = GainCurveFormat::defaultSamplesPerPoint);
+
+private:
+    //==============================================================================
+    double sampleRate;
+    int samplesPerPoint;
+    int pointsPerBlock;
+    juce::String presetName;
+
+    std::vector<float> points;
+    double pointAccumulator = 0.0;
+    int pointSampleCount = 0;
+    juce::int64 lengthInSamples = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainCurveWriter)
+};
@@ -0,0 +1,171 @@
+/*
+  ==============================================================================
+
+    InstanceRegistry.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "InstanceRegistry.h"
+
+InstanceRegistry::InstanceRegistry()
+{
+    for (int i = 0; i < maxInstances; ++i)
+        slots[static_cast<size_t>(i)].index = i;
+}
+
+InstanceRegistry& InstanceRegistry::getInstance()
+{
+    // Shared by every instance the host loads into this process
+    static InstanceRegistry registry;
+    return registry;
+}
+
+juce::String InstanceRegistry::describeMode(juce::uint32 flags)
+{
+    juce::StringArray parts;
+    parts.add((flags & naturalMode) != 0 ? "Natural" : "Standard");
+    if ((flags & lufsMode) != 0)     parts.add("LUFS");
+    if ((flags & lookAhead) != 0)    parts.add("Look-ahead");
+    if ((flags & shadowEngine) != 0) parts.add("A/B shadow");
+    if ((flags & sidechain) != 0)    parts.add("Sidechain");
+    return parts.joinIntoString(", ");
+}
+
+//==============================================================================
+InstanceRegistry::Slot* InstanceRegistry::acquire()
+{
+    for (auto& slot : slots)
+    {
+        bool expected = false;
+        if (slot.inUse.compare_exchange_strong(expected, true))
+        {
+            slot.resetForNewOwner();
+            return &slot;
+        }
+    }
+
+    return nullptr;
+}
+
+void InstanceRegistry::release(Slot* slot)
+{
+    if (slot != nullptr)
+        slot->inUse.store(false);
+}
+
+std::vector<InstanceRegistry::InstanceInfo> InstanceRegistry::getInstances() const
+{
+    std::vector<InstanceInfo> result;
+    const auto now = juce::Time::getMillisecondCounter();
+
+    for (const auto& slot : slots)
+    {
+        if (!slot.inUse.load())
+            continue;
+
+        InstanceInfo info;
+        info.slotIndex = slot.index;
+        info.name = slot.getName();
+        info.cpuLoad = slot.cpuLoad.load(std::memory_order_relaxed);
+        info.peakCpuLoad = slot.peakCpuLoad.load(std::memory_order_relaxed);
+        info.gainDb = slot.gainDb.load(std::memory_order_relaxed);
+        info.minGainDb = slot.minGainDb.load(std::memory_order_relaxed);
+        info.maxGainDb = slot.maxGainDb.load(std::memory_order_relaxed);
+        info.meanGainDb = slot.meanGainDb.load(std::memory_order_relaxed);
+        info.latencySamples = slot.latencySamples.load(std::memory_order_relaxed);
+        info.sampleRate = slot.sampleRate.load(std::memory_order_relaxed);
+        info.modeFlags = slot.modeFlags.load(std::memory_order_relaxed);
+        info.processing = now - slot.lastBlockTimeMs.load(std::memory_order_relaxed) < 1000;
+        result.push_back(info);
+    }
+
+    return result;
+}
+
+//==============================================================================
+void InstanceRegistry::Slot::resetForNewOwner()
+{
+    setName({});
+    cpuLoad.store(0.0f);
+    peakCpuLoad.store(0.0f);
+    gainDb.store(0.0f);
+    minGainDb.store(0.0f);
+    maxGainDb.store(0.0f);
+    meanGainDb.store(0.0f);
+    latencySamples.store(0);
+    sampleRate.store(0.0);
+    modeFlags.store(0);
+    lastBlockTimeMs.store(0);
+
+    smoothedLoad = 0.0f;
+    windowPeakLoad = 0.0f;
+    windowGainSum = 0.0;
+    windowBlocks = 0;
+    windowSeconds = 0.0;
+}
+
+void InstanceRegistry::Slot::setName(const juce::String& newName)
+{
+    const juce::SpinLock::ScopedLockType lock(nameLock);
+    name = newName;
+}
+
+juce::String InstanceRegistry::Slot::getName() const
+{
+    {
+        const juce::SpinLock::ScopedLockType lock(nameLock);
+        if (name.isNotEmpty())
+            return name;
+    }
+
+    return "magic.RIDE " + juce::String(index + 1);
+}
+
+void InstanceRegistry::Slot::publishBlock(int numSamples, double rate, double processSeconds, float blockGainDb)
+{
+    if (numSamples <= 0 || rate <= 0.0)
+        return;
+
+    const double blockSeconds = numSamples / rate;
+    const auto load = static_cast<float>(processSeconds / blockSeconds);
+
+    // ~300 ms smoothing regardless of block size
+    const auto alpha = static_cast<float>(blockSeconds / (blockSeconds + 0.3));
+    smoothedLoad += (load - smoothedLoad) * alpha;
+
+    if (windowBlocks == 0)
+    {
+        windowPeakLoad = load;
+        windowMinGain = windowMaxGain = blockGainDb;
+    }
+    else
+    {
+        windowPeakLoad = juce::jmax(windowPeakLoad, load);
+        windowMinGain = juce::jmin(windowMinGain, blockGainDb);
+        windowMaxGain = juce::jmax(windowMaxGain, blockGainDb);
+    }
+
+    windowGainSum += blockGainDb;
+    ++windowBlocks;
+    windowSeconds += blockSeconds;
+
+    cpuLoad.store(smoothedLoad, std::memory_order_relaxed);
+    gainDb.store(blockGainDb, std::memory_order_relaxed);
+    lastBlockTimeMs.store(juce::Time::getMillisecondCounter(), std::memory_order_relaxed);
+
+    if (windowSeconds >= statsWindowSeconds)
+    {
+        peakCpuLoad.store(windowPeakLoad, std::memory_order_relaxed);
+        minGainDb.store(windowMinGain, std::memory_order_relaxed);
+        maxGainDb.store(windowMaxGain, std::memory_order_relaxed);
+        meanGainDb.store(static_cast<float>(windowGainSum / windowBlocks), std::memory_order_relaxed);
+        sampleRate.store(rate, std::memory_order_relaxed);
+
+        windowGainSum = 0.0;
+        windowBlocks = 0;
+        windowSeconds = 0.0;
+    }
+}
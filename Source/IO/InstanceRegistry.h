@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    InstanceRegistry.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Process-wide table of every magic.RIDE instance loaded in the host, for
+    the instance dashboard. Each instance claims a fixed slot and publishes
+    its track name, CPU load, processing mode, gain statistics and latency.
+    The audio thread only does a few relaxed atomic stores per block; all
+    aggregation for the dashboard happens on the reading side.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+class InstanceRegistry
+{
+public:
+    //==============================================================================
+    /** What each instance is running (the main drivers of its CPU cost) */
+    enum ModeFlags : juce::uint32
+    {
+        naturalMode  = 1 << 0,
+        lufsMode     = 1 << 1,
+        lookAhead    = 1 << 2,
+        shadowEngine = 1 << 3,
+        sidechain    = 1 << 4
+    };
+
+    static juce::String describeMode(juce::uint32 flags);
+
+    //==============================================================================
+    /** One instance's published values. Written by its owner only. */
+    class Slot
+    {
+    public:
+        /** Message thread (name may come from any thread the host calls from) */
+        void setName(const juce::String& newName);
+        juce::String getName() const;
+
+        int getIndex() const { return index; }
+
+        void setLatencySamples(int samples) { latencySamples.store(samples, std::memory_order_relaxed); }
+        void setModeFlags(juce::uint32 flags) { modeFlags.store(flags, std::memory_order_relaxed); }
+
+        /** Audio thread, once per processed block. Never blocks or allocates.
+            @param processSeconds Time spent processing the block
+            @param blockGainDb    Ride gain at the end of the block
+        */
+        void publishBlock(int numSamples, double rate, double processSeconds, float blockGainDb);
+
+    private:
+        friend class InstanceRegistry;
+
+        std::atomic<bool> inUse { false };
+        int index = 0;
+
+        mutable juce::SpinLock nameLock;
+        juce::String name;
+
+        // Published values (relaxed - each is independent)
+        std::atomic<float> cpuLoad { 0.0f };        // Smoothed fraction of the block's real-time budget
+        std::atomic<float> peakCpuLoad { 0.0f };    // Worst block in the last stats window
+        std::atomic<float> gainDb { 0.0f };
+        std::atomic<float> minGainDb { 0.0f };
+        std::atomic<float> maxGainDb { 0.0f };
+        std::atomic<float> meanGainDb { 0.0f };
+        std::atomic<int> latencySamples { 0 };
+        std::atomic<double> sampleRate { 0.0 };
+        std::atomic<juce::uint32> modeFlags { 0 };
+        std::atomic<juce::uint32> lastBlockTimeMs { 0 };
+
+        // Audio thread accumulators for the current stats window
+        float smoothedLoad = 0.0f;
+        float windowPeakLoad = 0.0f;
+        float windowMinGain = 0.0f;
+        float windowMaxGain = 0.0f;
+        double windowGainSum = 0.0;
+        int windowBlocks = 0;
+        double windowSeconds = 0.0;
+
+        void resetForNewOwner();
+    };
+
+    //==============================================================================
+    /** Read-side copy of one slot */
+    struct InstanceInfo
+    {
+        int slotIndex = 0;
+        juce::String name;
+        float cpuLoad = 0.0f;
+        float peakCpuLoad = 0.0f;
+        float gainDb = 0.0f;
+        float minGainDb = 0.0f;
+        float maxGainDb = 0.0f;
+        float meanGainDb = 0.0f;
+        int latencySamples = 0;
+        double sampleRate = 0.0;
+        juce::uint32 modeFlags = 0;
+        bool processing = false;    // A block arrived within the last second
+    };
+
+    //==============================================================================
+    static InstanceRegistry& getInstance();
+
+    /** Claims a free slot (lock-free), or nullptr if all are taken */
+    Slot* acquire();
+    void release(Slot* slot);
+
+    /** Copies every claimed slot (message thread; never touches the audio threads) */
+    std::vector<InstanceInfo> getInstances() const;
+
+    static constexpr int maxInstances = 512;
+
+    // Length of the min/max/mean gain and peak CPU window
+    static constexpr double statsWindowSeconds = 1.0;
+
+private:
+    InstanceRegistry();
+
+    std::array<Slot, maxInstances> slots;
+
+    JUCE_DECLARE_NON_COPYABLE(InstanceRegistry)
+};
@@ -0,0 +1,382 @@
+/*
+  ==============================================================================
+
+    LoopRenderer.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "LoopRenderer.h"
+#include "../DSP/RideDetector.h"
+#include "../DSP/RideCore.h"
+#include <algorithm>
+#include <limits>
+
+LoopRenderer::LoopRenderer()
+    : juce::Thread("magic.RIDE Loop Render")
+{
+    formatManager.registerBasicFormats();
+}
+
+LoopRenderer::~LoopRenderer()
+{
+    signalThreadShouldExit();
+    notify();
+    stopThread(4000);
+}
+
+//==============================================================================
+void LoopRenderer::prepare(double sampleRate)
+{
+    if (sampleRate <= 0.0 || sampleRate == playbackSampleRate)
+        return;
+
+    playbackSampleRate = sampleRate;
+
+    // Re-cache the region at the new rate; until then the audio thread ignores
+    // renders made for the old one
+    const juce::ScopedLock sl(jobLock);
+    job.sampleRate = sampleRate;
+    if (regionActive.load())
+    {
+        renderPending.store(true);
+        notify();
+    }
+}
+
+bool LoopRenderer::setRegion(const juce::File& file, double startSeconds, double endSeconds,
+                             const RideSettings& settings)
+{
+    if (endSeconds <= startSeconds || endSeconds - startSeconds > maxRegionSeconds)
+        return false;
+
+    regionStart = startSeconds;
+    regionEnd = endSeconds;
+
+    {
+        const juce::ScopedLock sl(jobLock);
+        job.file = file;
+        job.startSeconds = startSeconds;
+        job.endSeconds = endSeconds;
+        job.sampleRate = playbackSampleRate;
+        job.settings = settings;
+        ++job.regionId;
+    }
+
+    playbackPosition.store(startSeconds);
+    regionActive.store(true);
+    renderPending.store(true);
+
+    // Plugin instances never loop, so the worker only exists once a loop is set
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::normal);
+
+    notify();
+    return true;
+}
+
+void LoopRenderer::clearRegion()
+{
+    regionActive.store(false);
+    pendingRender.store(nullptr);
+
+    const juce::ScopedLock sl(jobLock);
+    ++job.regionId;     // Discards any render still in flight
+    job.file = juce::File();
+}
+
+void LoopRenderer::setRideSettings(const RideSettings& settings)
+{
+    if (!regionActive.load())
+        return;
+
+    {
+        const juce::ScopedLock sl(jobLock);
+        if (settings == job.settings)
+            return;
+        job.settings = settings;
+    }
+
+    renderPending.store(true);
+    notify();
+}
+
+std::shared_ptr<const LoopRender> LoopRenderer::getLatestRender() const
+{
+    const juce::ScopedLock sl(rendersLock);
+    for (auto it = renders.rbegin(); it != renders.rend(); ++it)
+        if ((*it)->hasGain())
+            return *it;
+    return nullptr;
+}
+
+void LoopRenderer::collectGarbage()
+{
+    const int active = activeSequence.load();
+
+    const juce::ScopedLock sl(rendersLock);
+
+    // Keep the newest render with a gain curve for display even if it's old
+    std::shared_ptr<LoopRender> newestWithGain;
+    for (auto it = renders.rbegin(); it != renders.rend() && newestWithGain == nullptr; ++it)
+        if ((*it)->hasGain())
+            newestWithGain = *it;
+
+    renders.erase(std::remove_if(renders.begin(), renders.end(), [&](const std::shared_ptr<LoopRender>& r)
+                  {
+                      return r->sequence < active && r != newestWithGain;
+                  }),
+                  renders.end());
+}
+
+void LoopRenderer::publish(std::unique_ptr<LoopRender> render)
+{
+    LoopRender* raw = nullptr;
+    {
+        const juce::ScopedLock sl(rendersLock);
+        render->sequence = nextSequence++;
+        raw = render.get();
+        renders.push_back(std::shared_ptr<LoopRender>(std::move(render)));
+    }
+    pendingRender.store(raw);
+}
+
+//==============================================================================
+LoopRenderer::BlockResult LoopRenderer::readNextBlock(juce::AudioBuffer<float>& buffer, int numChannels,
+                                                      float* gainDbOut, int numSamples)
+{
+    // A different region (or a re-cache at a new rate) starts immediately; a new
+    // render of the same region waits for the loop boundary so a pass is never
+    // half one ride, half another
+    if (auto* pending = pendingRender.load())
+    {
+        if (activeRender == nullptr || pending->regionId != activeRender->regionId
+            || activeRender->sampleRate != playbackSampleRate)
+        {
+            activeRender = pending;
+            activeSequence.store(pending->sequence);
+            readPosition = 0;
+        }
+    }
+
+    auto* render = activeRender;
+    if (render == nullptr || render->getNumSamples() == 0 || render->sampleRate != playbackSampleRate)
+        return BlockResult::notReady;
+
+    for (int written = 0; written < numSamples;)
+    {
+        if (readPosition >= render->getNumSamples())
+        {
+            readPosition = 0;
+
+            if (auto* pending = pendingRender.load(); pending != nullptr && pending->sequence > render->sequence
+                                                      && pending->sampleRate == playbackSampleRate)
+            {
+                activeRender = render = pending;
+                activeSequence.store(pending->sequence);
+            }
+        }
+
+        const int count = juce::jmin(numSamples - written, render->getNumSamples() - readPosition);
+        const auto& audio = *render->audio;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            buffer.copyFrom(ch, written, audio, juce::jmin(ch, audio.getNumChannels() - 1), readPosition, count);
+
+        if (render->hasGain())
+            std::copy_n(render->gainDb.data() + readPosition, count, gainDbOut + written);
+
+        written += count;
+        readPosition += count;
+    }
+
+    playbackPosition.store(render->startSeconds + readPosition / render->sampleRate);
+    return render->hasGain() ? BlockResult::audioAndGain : BlockResult::audioOnly;
+}
+
+//==============================================================================
+void LoopRenderer::run()
+{
+    while (!threadShouldExit())
+    {
+        if (!renderPending.exchange(false))
+        {
+            wait(-1);
+            continue;
+        }
+
+        Job current;
+        {
+            const juce::ScopedLock sl(jobLock);
+            current = job;
+        }
+
+        if (current.file == juce::File())
+            continue;
+
+        workerBusy.store(true);
+
+        // Region audio: only re-read when the region or playback rate changed
+        if (current.file != cachedFile || current.startSeconds != cachedStart
+            || current.endSeconds != cachedEnd || current.sampleRate != cachedSampleRate)
+        {
+            if (!loadRegion(current.file, current.startSeconds, current.endSeconds, current.sampleRate))
+            {
+                workerBusy.store(false);
+                continue;
+            }
+        }
+
+        // Let the audio thread start looping the raw region while the ride renders
+        if (current.regionId != cachedRegionId)
+        {
+            cachedRegionId = current.regionId;
+
+            auto render = std::make_unique<LoopRender>();
+            render->audio = cachedAudio;
+            render->sampleRate = current.sampleRate;
+            render->startSeconds = current.startSeconds;
+            render->endSeconds = current.endSeconds;
+            render->regionId = current.regionId;
+            publish(std::move(render));
+        }
+
+        auto render = std::make_unique<LoopRender>();
+        if (renderGain(current.sampleRate, current.settings, render->gainDb))
+        {
+            // Skip the publish if the region was cleared or replaced meanwhile
+            const juce::ScopedLock sl(jobLock);
+            if (job.regionId == current.regionId && regionActive.load())
+            {
+                render->audio = cachedAudio;
+                render->sampleRate = current.sampleRate;
+                render->startSeconds = current.startSeconds;
+                render->endSeconds = current.endSeconds;
+                render->regionId = current.regionId;
+                publish(std::move(render));
+            }
+        }
+
+        workerBusy.store(false);
+    }
+}
+
+bool LoopRenderer::loadRegion(const juce::File& file, double startSeconds, double endSeconds, double sampleRate)
+{
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+    if (reader == nullptr || reader->sampleRate <= 0.0)
+        return false;
+
+    const double fileRate = reader->sampleRate;
+    const double preRollStart = juce::jmax(0.0, startSeconds - preRollSeconds);
+
+    if (endSeconds - startSeconds > maxRegionSeconds)
+        return false;
+
+    const auto firstSample = static_cast<juce::int64>(preRollStart * fileRate);
+    const auto endSample = juce::jmin(reader->lengthInSamples, static_cast<juce::int64>(endSeconds * fileRate));
+    const auto numFileSamples64 = endSample - firstSample;
+    const double ratio = fileRate / sampleRate;
+    if (numFileSamples64 <= 0
+        || numFileSamples64 > std::numeric_limits<int>::max()
+        || static_cast<double>(numFileSamples64) / ratio > std::numeric_limits<int>::max())
+        return false;
+
+    const int numFileSamples = static_cast<int>(numFileSamples64);
+    const int numChannels = juce::jlimit(1, 2, static_cast<int>(reader->numChannels));
+
+    // Convert to the playback rate once, so the audio thread only copies
+    const int numSamples = static_cast<int>(numFileSamples / ratio);
+    if (numSamples <= 0)
+        return false;
+
+    // The file-rate copy only lives until it is converted, so at most two
+    // copies of the region are held at once
+    cachedSource.setSize(numChannels, numSamples);
+    {
+        juce::AudioBuffer<float> fileAudio(numChannels, numFileSamples);
+        reader->read(&fileAudio, 0, numFileSamples, firstSample, true, numChannels > 1);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            if (ratio == 1.0)
+            {
+                cachedSource.copyFrom(ch, 0, fileAudio, ch, 0, numSamples);
+            }
+            else
+            {
+                juce::LagrangeInterpolator interpolator;
+                interpolator.process(ratio, fileAudio.getReadPointer(ch), cachedSource.getWritePointer(ch),
+                                     numSamples, numFileSamples, 0);
+            }
+        }
+    }
+
+    cachedPreRollSamples = juce::jmin(numSamples - 1, static_cast<int>((startSeconds - preRollStart) * sampleRate));
+
+    auto region = std::make_shared<juce::AudioBuffer<float>>(numChannels, numSamples - cachedPreRollSamples);
+    for (int ch = 0; ch < numChannels; ++ch)
+        region->copyFrom(ch, 0, cachedSource, ch, cachedPreRollSamples, region->getNumSamples());
+
+    cachedAudio = std::move(region);
+    cachedFile = file;
+    cachedStart = startSeconds;
+    cachedEnd = endSeconds;
+    cachedSampleRate = sampleRate;
+    cachedRegionId = 0;     // New audio always goes out as a fresh region
+    return true;
+}
+
+bool LoopRenderer::renderGain(double sampleRate, const RideSettings& settings, std::vector<float>& gainDb)
+{
+    const int totalSamples = cachedSource.getNumSamples();
+    const int regionSamples = totalSamples - cachedPreRollSamples;
+    if (regionSamples <= 0)
+        return false;
+
+    // Same detector/decision code the processor runs, from a clean state each time
+    RideDetector detector;
+    RideCore core;
+    detector.prepare(sampleRate, rideBlockSize, settings.speed);
+    core.prepare(sampleRate);
+    core.setSettings(settings);
+
+    const int numChannels = cachedSource.getNumChannels();
+    const float channelScale = 1.0f / static_cast<float>(numChannels);
+
+    std::vector<float> mono(static_cast<size_t>(rideBlockSize), 0.0f);
+    std::vector<float> fullGainDb(static_cast<size_t>(totalSamples), 0.0f);
+
+    for (int blockStart = 0; blockStart < totalSamples; blockStart += rideBlockSize)
+    {
+        if (threadShouldExit() || renderPending.load())
+            return false;   // Superseded - the next job starts right away
+
+        const int blockSize = juce::jmin(rideBlockSize, totalSamples - blockStart);
+        for (int i = 0; i < blockSize; ++i)
+        {
+            float sum = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                sum += cachedSource.getSample(ch, blockStart + i);
+            mono[static_cast<size_t>(i)] = sum * channelScale;
+        }
+
+        detector.process(mono.data(), blockSize, settings);
+        core.processBlock(detector, blockSize, fullGainDb.data() + blockStart);
+    }
+
+    // With look-ahead the live path delays the audio and applies gains computed
+    // from the undelayed input; bake that shift in so playback needs no delay line
+    const int lookAhead = settings.useLookAhead ? juce::jmax(0, settings.lookAheadSamples) : 0;
+
+    gainDb.resize(static_cast<size_t>(regionSamples));
+    for (int i = 0; i < regionSamples; ++i)
+    {
+        const int source = juce::jmin(totalSamples - 1, cachedPreRollSamples + i + lookAhead);
+        gainDb[static_cast<size_t>(i)] = fullGainDb[static_cast<size_t>(source)];
+    }
+
+    return true;
+}
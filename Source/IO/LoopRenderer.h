@@ -0,0 +1,156 @@
+/*
+  ==============================================================================
+
+    LoopRenderer.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Standalone loop region held in RAM. A background thread reads the region
+    once, then re-renders its ride gain curve (faster than real time) whenever
+    the settings change. The audio thread plays the cached region with the
+    latest finished render, switching renders only at the loop boundary.
+    Regions are limited to maxRegionSeconds, since the region (plus its
+    pre-roll) is held in RAM at the playback rate. The worker thread is
+    started when the first region is set.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "../DSP/RideSettings.h"
+
+//==============================================================================
+/** One immutable render of the loop region. */
+struct LoopRender
+{
+    std::shared_ptr<const juce::AudioBuffer<float>> audio;   // Region at playback rate (unprocessed)
+    std::vector<float> gainDb;      // Ride per sample, look-ahead pre-aligned (empty = not rendered yet)
+
+    double sampleRate = 44100.0;
+    double startSeconds = 0.0;
+    double endSeconds = 0.0;
+    int regionId = 0;
+    int sequence = 0;
+
+    int getNumSamples() const { return audio != nullptr ? audio->getNumSamples() : 0; }
+    bool hasGain() const { return !gainDb.empty(); }
+};
+
+//==============================================================================
+class LoopRenderer : private juce::Thread
+{
+public:
+    LoopRenderer();
+    ~LoopRenderer() override;
+
+    //==============================================================================
+    /** Playback rate the region is cached at (call from prepareToPlay) */
+    void prepare(double sampleRate);
+
+    /** Caches [startSeconds, endSeconds) of a file and renders it (message thread).
+        Returns false (and keeps the current region) if the region is empty or
+        longer than maxRegionSeconds.
+    */
+    bool setRegion(const juce::File& file, double startSeconds, double endSeconds,
+                   const RideSettings& settings);
+    void clearRegion();
+
+    /** Queues a re-render when the settings differ from the last request (message thread) */
+    void setRideSettings(const RideSettings& settings);
+
+    bool hasRegion() const { return regionActive.load(); }
+    bool isRendering() const { return renderPending.load() || workerBusy.load(); }
+    double getStartSeconds() const { return regionStart; }
+    double getEndSeconds() const { return regionEnd; }
+
+    /** Latest render with a gain curve, for display (message thread) */
+    std::shared_ptr<const LoopRender> getLatestRender() const;
+
+    /** Frees renders the audio thread can no longer reach (message thread) */
+    void collectGarbage();
+
+    //==============================================================================
+    enum class BlockResult
+    {
+        notReady,       // Region not cached yet - keep playing the transport
+        audioOnly,      // Region audio written, no render yet - ride live
+        audioAndGain    // Region audio and its rendered gain curve written
+    };
+
+    /** Audio thread: fills the block from the cached region, wrapping at the end,
+        and writes the rendered gain (dB) to gainDbOut when one is available.
+        New renders are picked up at the loop boundary. Never blocks or allocates.
+    */
+    BlockResult readNextBlock(juce::AudioBuffer<float>& buffer, int numChannels,
+                              float* gainDbOut, int numSamples);
+
+    /** Audio-thread read position, in seconds from the start of the file */
+    double getPlaybackPosition() const { return playbackPosition.load(); }
+
+    /** Longest loop region: 5 minutes is ~230 MB of stereo float at 96 kHz
+        including the pre-roll, and keeps sample counts well inside int */
+    static constexpr double maxRegionSeconds = 300.0;
+
+private:
+    //==============================================================================
+    void run() override;
+    void publish(std::unique_ptr<LoopRender> render);
+
+    bool loadRegion(const juce::File& file, double startSeconds, double endSeconds, double sampleRate);
+    bool renderGain(double sampleRate, const RideSettings& settings, std::vector<float>& gainDb);
+
+    //==============================================================================
+    struct Job
+    {
+        juce::File file;
+        double startSeconds = 0.0;
+        double endSeconds = 0.0;
+        double sampleRate = 44100.0;
+        RideSettings settings;
+        int regionId = 0;
+    };
+
+    juce::CriticalSection jobLock;
+    Job job;
+    std::atomic<bool> renderPending { false };
+    std::atomic<bool> workerBusy { false };
+    std::atomic<bool> regionActive { false };
+    double regionStart = 0.0, regionEnd = 0.0;
+    double playbackSampleRate = 44100.0;
+
+    // Worker-side cache of the region audio (reused across renders). The source
+    // includes the pre-roll; the shared region buffer is what the audio thread plays.
+    juce::AudioBuffer<float> cachedSource;
+    int cachedPreRollSamples = 0;
+    std::shared_ptr<const juce::AudioBuffer<float>> cachedAudio;
+    int cachedRegionId = 0;
+    juce::File cachedFile;
+    double cachedStart = 0.0, cachedEnd = 0.0, cachedSampleRate = 0.0;
+    juce::AudioFormatManager formatManager;
+
+    // Renders are owned here; the audio thread only sees raw pointers. A render
+    // is freed once its sequence is older than the one the audio thread plays,
+    // since the audio thread only ever moves forward.
+    juce::CriticalSection rendersLock;
+    std::vector<std::shared_ptr<LoopRender>> renders;
+    int nextSequence = 1;
+
+    std::atomic<LoopRender*> pendingRender { nullptr };
+    std::atomic<int> activeSequence { 0 };
+    std::atomic<double> playbackPosition { 0.0 };
+
+    // Audio thread state
+    LoopRender* activeRender = nullptr;
+    int readPosition = 0;
+
+    // Detector warm-up before the region so each pass starts from settled state
+    static constexpr double preRollSeconds = 2.0;
+    static constexpr int rideBlockSize = 512;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoopRenderer)
+};
@@ -0,0 +1,486 @@
+/*
+  ==============================================================================
+
+    OverviewBuilder.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "OverviewBuilder.h"
+#include "../DSP/RideDetector.h"
+#include "../DSP/RideCore.h"
+
+namespace
+{
+    constexpr int cacheMagic = 0x564f524d;  // "MROV"
+    constexpr int rideCacheMagic = 0x5244524d;  // "MRDR"
+    constexpr int cacheVersion = 2;
+
+    // FNV-1a, 64-bit - stable across runs and platforms (unlike std::hash)
+    juce::uint64 fnv1a(const void* data, size_t numBytes, juce::uint64 hash = 0xcbf29ce484222325ULL)
+    {
+        auto* bytes = static_cast<const juce::uint8*>(data);
+        for (size_t i = 0; i < numBytes; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+}
+
+OverviewBuilder::OverviewBuilder()
+    : juce::Thread("magic.RIDE Overview")
+{
+    formatManager.registerBasicFormats();
+}
+
+OverviewBuilder::~OverviewBuilder()
+{
+    cancelPendingUpdate();
+    signalThreadShouldExit();
+    notify();
+    stopThread(4000);
+}
+
+//==============================================================================
+void OverviewBuilder::build(const juce::File& file, const RideSettings& settings)
+{
+    {
+        // A job that is still running sees the new sequence and bails out at
+        // its next check; the worker then picks this one up
+        const juce::ScopedLock sl(jobLock);
+        jobFile = file;
+        jobSettings = settings;
+        jobIsNewFile = (file != currentFile || overview == nullptr);
+        jobPending = true;
+        ++jobSequence;
+        building.store(true);
+    }
+
+    currentFile = file;
+    currentSettings = settings;
+    progress.store(0.0f);
+
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+
+    notify();
+}
+
+void OverviewBuilder::updateRideSettings(const RideSettings& settings)
+{
+    if (currentFile == juce::File() || settings == currentSettings)
+        return;
+
+    build(currentFile, settings);
+}
+
+void OverviewBuilder::cancel()
+{
+    const juce::ScopedLock sl(jobLock);
+    jobPending = false;
+    ++jobSequence;
+    building.store(false);
+}
+
+//==============================================================================
+void OverviewBuilder::run()
+{
+    while (!threadShouldExit())
+    {
+        juce::File file;
+        RideSettings settings;
+        bool isNewFile = false;
+        {
+            const juce::ScopedLock sl(jobLock);
+            if (jobPending)
+            {
+                file = jobFile;
+                settings = jobSettings;
+                isNewFile = jobIsNewFile;
+                jobPending = false;
+                runningJob = jobSequence.load();
+            }
+        }
+
+        if (file == juce::File())
+        {
+            wait(-1);
+            continue;
+        }
+
+        runJob(file, settings, isNewFile);
+
+        {
+            const juce::ScopedLock sl(jobLock);
+            if (runningJob == jobSequence.load())
+                building.store(false);
+        }
+    }
+}
+
+void OverviewBuilder::runJob(const juce::File& file, const RideSettings& settings, bool isNewFile)
+{
+    const auto settingsHash = hashSettings(settings);
+
+    const auto fingerprint = fingerprintFile(file);
+    if (fingerprint.isEmpty() || shouldStop())
+        return;
+
+    const auto folder = getCacheFolder();
+    const auto summaryFile = folder.getChildFile(fingerprint + ".overview");
+    const auto rideFile = folder.getChildFile(fingerprint + "-" + juce::String::toHexString(settingsHash) + ".overviewride");
+
+    // The waveform summary only depends on the file; the ride preview also on the settings
+    auto summary = readSummaryCache(summaryFile);
+    if (summary != nullptr)
+    {
+        // Cache hits count as uses, so trimCache evicts the least recently used
+        const auto now = juce::Time::getCurrentTime();
+        summaryFile.setLastModificationTime(now);
+
+        if (readRideCache(rideFile, *summary, settingsHash))
+        {
+            rideFile.setLastModificationTime(now);
+            progress.store(1.0f);
+            publish(std::move(summary));
+            return;
+        }
+
+        if (isNewFile)
+            publish(std::make_shared<OverviewData>(*summary));
+    }
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+    if (reader == nullptr)
+        return;
+
+    // The ride runs on the samples themselves, so a settings change still reads
+    // the file, but only the ride pass is redone
+    auto result = analyse(*reader, settings, summary.get());
+    if (result == nullptr || shouldStop())
+        return;
+
+    result->rideSettingsHash = settingsHash;
+    if (summary == nullptr)
+        writeSummaryCache(summaryFile, *result);
+    writeRideCache(rideFile, *result);
+    trimCache(folder);
+
+    progress.store(1.0f);
+    publish(std::move(result));
+}
+
+void OverviewBuilder::publish(std::shared_ptr<OverviewData> result)
+{
+    {
+        const juce::SpinLock::ScopedLockType lock(resultLock);
+        pendingResult = std::move(result);
+        pendingResultJob = runningJob;
+    }
+    triggerAsyncUpdate();
+}
+
+void OverviewBuilder::handleAsyncUpdate()
+{
+    std::shared_ptr<OverviewData> result;
+    int resultJob = 0;
+    {
+        const juce::SpinLock::ScopedLockType lock(resultLock);
+        result = std::move(pendingResult);
+        resultJob = pendingResultJob;
+    }
+
+    // Drop results of a build that was cancelled or replaced after it finished
+    if (result == nullptr || resultJob != jobSequence.load())
+        return;
+
+    overview = std::move(result);
+
+    if (onOverviewReady)
+        onOverviewReady();
+}
+
+//==============================================================================
+std::shared_ptr<OverviewData> OverviewBuilder::analyse(juce::AudioFormatReader& reader,
+                                                       const RideSettings& settings,
+                                                       const OverviewData* summary)
+{
+    const juce::int64 length = reader.lengthInSamples;
+    const double sampleRate = reader.sampleRate > 0.0 ? reader.sampleRate : 44100.0;
+    if (length <= 0)
+        return nullptr;
+
+    auto data = std::make_shared<OverviewData>();
+    data->sampleRate = sampleRate;
+    data->lengthInSamples = length;
+    data->samplesPerBucket = static_cast<int>(juce::jmax(static_cast<juce::int64>(minSamplesPerBucket),
+                                                         (length + maxBuckets - 1) / maxBuckets));
+
+    const auto numBuckets = static_cast<size_t>((length + data->samplesPerBucket - 1) / data->samplesPerBucket);
+    const bool needsSummary = summary == nullptr
+                           || summary->getNumBuckets() != static_cast<int>(numBuckets)
+                           || summary->samplesPerBucket != data->samplesPerBucket;
+    if (needsSummary)
+    {
+        data->minValues.assign(numBuckets, 0.0f);
+        data->maxValues.assign(numBuckets, 0.0f);
+        data->rmsValues.assign(numBuckets, 0.0f);
+    }
+    else
+    {
+        data->minValues = summary->minValues;
+        data->maxValues = summary->maxValues;
+        data->rmsValues = summary->rmsValues;
+    }
+    data->rideGainDb.assign(numBuckets, 0.0f);
+
+    // Offline ride with the same detector/decision code the processor runs
+    RideDetector detector;
+    RideCore core;
+    detector.prepare(sampleRate, rideBlockSize, settings.speed);
+    core.prepare(sampleRate);
+    core.setSettings(settings);
+
+    const int numChannels = juce::jlimit(1, 2, static_cast<int>(reader.numChannels));
+    const int chunkSize = rideBlockSize * 16;
+    juce::AudioBuffer<float> buffer(numChannels, chunkSize);
+    std::vector<float> mono(static_cast<size_t>(chunkSize), 0.0f);
+    std::vector<float> gainDb(static_cast<size_t>(rideBlockSize), 0.0f);
+
+    // Running bucket accumulators
+    size_t bucket = 0;
+    int bucketCount = 0;
+    float bucketMin = 0.0f, bucketMax = 0.0f;
+    double bucketSumSquares = 0.0, bucketGainSum = 0.0;
+
+    auto flushBucket = [&]
+    {
+        if (bucketCount == 0 || bucket >= numBuckets)
+            return;
+        if (needsSummary)
+        {
+            data->minValues[bucket] = bucketMin;
+            data->maxValues[bucket] = bucketMax;
+            data->rmsValues[bucket] = static_cast<float>(std::sqrt(bucketSumSquares / bucketCount));
+        }
+        data->rideGainDb[bucket] = static_cast<float>(bucketGainSum / bucketCount);
+        ++bucket;
+        bucketCount = 0;
+        bucketMin = bucketMax = 0.0f;
+        bucketSumSquares = bucketGainSum = 0.0;
+    };
+
+    for (juce::int64 position = 0; position < length; position += chunkSize)
+    {
+        if (shouldStop())
+            return nullptr;
+
+        const int numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(chunkSize), length - position));
+        buffer.clear();
+        reader.read(&buffer, 0, numSamples, position, true, true);
+
+        // Mono mix (same as the processor's detection sum)
+        const float channelScale = 1.0f / static_cast<float>(numChannels);
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float sum = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                sum += buffer.getSample(ch, i);
+            mono[static_cast<size_t>(i)] = sum * channelScale;
+        }
+
+        for (int blockStart = 0; blockStart < numSamples; blockStart += rideBlockSize)
+        {
+            const int blockSize = juce::jmin(rideBlockSize, numSamples - blockStart);
+            const float* blockData = mono.data() + blockStart;
+
+            detector.process(blockData, blockSize, settings);
+            core.processBlock(detector, blockSize, gainDb.data());
+
+            for (int i = 0; i < blockSize; ++i)
+            {
+                if (needsSummary)
+                {
+                    const float x = blockData[i];
+                    bucketMin = bucketCount == 0 ? x : juce::jmin(bucketMin, x);
+                    bucketMax = bucketCount == 0 ? x : juce::jmax(bucketMax, x);
+                    bucketSumSquares += static_cast<double>(x) * x;
+                }
+                bucketGainSum += gainDb[static_cast<size_t>(i)];
+
+                if (++bucketCount == data->samplesPerBucket)
+                    flushBucket();
+            }
+        }
+
+        progress.store(static_cast<float>(static_cast<double>(position + numSamples) / static_cast<double>(length)));
+    }
+
+    flushBucket();
+    return data;
+}
+
+//==============================================================================
+juce::int64 OverviewBuilder::hashSettings(const RideSettings& s)
+{
+    juce::MemoryOutputStream stream;
+    for (float v : { s.targetDb, s.boostRangeDb, s.cutRangeDb, s.speed, s.attackMs, s.releaseMs,
+                     s.holdMs, s.breathReductionDb, s.transientPreservation, s.noiseFloorDb })
+        stream.writeFloat(v);
+    for (bool b : { s.naturalMode, s.smartSilence, s.vocalFocus, s.useLufs, s.useLookAhead })
+        stream.writeBool(b);
+    stream.writeInt(s.lookAheadSamples);
+
+    return static_cast<juce::int64>(fnv1a(stream.getData(), stream.getDataSize()));
+}
+
+juce::String OverviewBuilder::fingerprintFile(const juce::File& file)
+{
+    juce::FileInputStream in(file);
+    if (!in.openedOk())
+        return {};
+
+    const juce::int64 size = in.getTotalLength();
+    const juce::int64 sliceSize = 256 * 1024;
+
+    // The modification time catches edits inside the regions that aren't sampled
+    const juce::int64 modified = file.getLastModificationTime().toMilliseconds();
+
+    juce::uint64 hash = fnv1a(&size, sizeof(size));
+    hash = fnv1a(&modified, sizeof(modified), hash);
+    juce::HeapBlock<char> slice(static_cast<size_t>(sliceSize));
+
+    // Head, middle and tail are enough to tell files apart without reading hours of audio
+    for (juce::int64 start : { static_cast<juce::int64>(0), size / 2 - sliceSize / 2, size - sliceSize })
+    {
+        if (!in.setPosition(juce::jmax(static_cast<juce::int64>(0), start)))
+            return {};
+        const int bytesRead = in.read(slice.getData(), static_cast<int>(sliceSize));
+        hash = fnv1a(slice.getData(), static_cast<size_t>(juce::jmax(0, bytesRead)), hash);
+    }
+
+    return juce::String::toHexString(static_cast<juce::int64>(hash));
+}
+
+juce::File OverviewBuilder::getCacheFolder()
+{
+    auto appData = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory);
+    #if JUCE_MAC
+    auto cacheDir = appData.getChildFile("Application Support").getChildFile("MBM Audio").getChildFile("magic.RIDE").getChildFile("Overview Cache");
+    #else
+    auto cacheDir = appData.getChildFile("MBM Audio").getChildFile("magic.RIDE").getChildFile("Overview Cache");
+    #endif
+    cacheDir.createDirectory();
+    return cacheDir;
+}
+
+//==============================================================================
+std::shared_ptr<OverviewData> OverviewBuilder::readSummaryCache(const juce::File& cacheFile)
+{
+    juce::FileInputStream in(cacheFile);
+    if (!in.openedOk())
+        return nullptr;
+
+    if (in.readInt() != cacheMagic || in.readInt() != cacheVersion)
+        return nullptr;
+
+    auto data = std::make_shared<OverviewData>();
+    data->sampleRate = in.readDouble();
+    data->lengthInSamples = in.readInt64();
+    data->samplesPerBucket = in.readInt();
+    const int numBuckets = in.readInt();
+
+    if (numBuckets <= 0 || numBuckets > maxBuckets || data->samplesPerBucket <= 0)
+        return nullptr;
+
+    for (auto* values : { &data->minValues, &data->maxValues, &data->rmsValues })
+    {
+        values->resize(static_cast<size_t>(numBuckets));
+        const auto numBytes = static_cast<int>(values->size() * sizeof(float));
+        if (in.read(values->data(), numBytes) != numBytes)
+            return nullptr;
+    }
+
+    return data;
+}
+
+void OverviewBuilder::writeSummaryCache(const juce::File& cacheFile, const OverviewData& data)
+{
+    // Write to a temp file and swap, so a crash never leaves a truncated cache entry
+    juce::TemporaryFile temp(cacheFile);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return;
+
+        out.writeInt(cacheMagic);
+        out.writeInt(cacheVersion);
+        out.writeDouble(data.sampleRate);
+        out.writeInt64(data.lengthInSamples);
+        out.writeInt(data.samplesPerBucket);
+        out.writeInt(data.getNumBuckets());
+
+        for (auto* values : { &data.minValues, &data.maxValues, &data.rmsValues })
+            out.write(values->data(), values->size() * sizeof(float));
+    }
+    temp.overwriteTargetFileWithTemporary();
+}
+
+bool OverviewBuilder::readRideCache(const juce::File& cacheFile, OverviewData& data, juce::int64 settingsHash)
+{
+    juce::FileInputStream in(cacheFile);
+    if (!in.openedOk())
+        return false;
+
+    if (in.readInt() != rideCacheMagic || in.readInt() != cacheVersion
+        || in.readInt64() != settingsHash || in.readInt() != data.getNumBuckets())
+        return false;
+
+    std::vector<float> rideGainDb(static_cast<size_t>(data.getNumBuckets()));
+    const auto numBytes = static_cast<int>(rideGainDb.size() * sizeof(float));
+    if (in.read(rideGainDb.data(), numBytes) != numBytes)
+        return false;
+
+    data.rideGainDb = std::move(rideGainDb);
+    data.rideSettingsHash = settingsHash;
+    return true;
+}
+
+void OverviewBuilder::writeRideCache(const juce::File& cacheFile, const OverviewData& data)
+{
+    juce::TemporaryFile temp(cacheFile);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return;
+
+        out.writeInt(rideCacheMagic);
+        out.writeInt(cacheVersion);
+        out.writeInt64(data.rideSettingsHash);
+        out.writeInt(data.getNumBuckets());
+        out.write(data.rideGainDb.data(), data.rideGainDb.size() * sizeof(float));
+    }
+    temp.overwriteTargetFileWithTemporary();
+}
+
+void OverviewBuilder::trimCache(const juce::File& folder)
+{
+    // Summaries and ride previews share the budget; ride previews are small
+    // and many per file, so they simply age out with the rest. Hits refresh
+    // the modification time, so the oldest is the least recently used.
+    auto files = folder.findChildFiles(juce::File::findFiles, false, "*.overview;*.overviewride");
+    if (files.size() <= maxCacheFiles)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const juce::File& a, const juce::File& b)
+    {
+        return a.getLastModificationTime() < b.getLastModificationTime();
+    });
+
+    for (int i = 0; i < files.size() - maxCacheFiles; ++i)
+        files.getReference(i).deleteFile();
+}
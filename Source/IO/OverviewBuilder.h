@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    OverviewBuilder.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Builds the whole-file overview for the Standalone: min/max/RMS per bucket
+    plus an offline ride preview, on a background thread. The waveform summary
+    is cached on disk keyed by a fingerprint of the file, and each ride preview
+    next to it keyed by the fingerprint and the ride settings, so re-opening a
+    file is instant and a settings change only re-runs the ride pass. Never
+    touches the audio thread or the processor's DSP state.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_events/juce_events.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "../DSP/RideSettings.h"
+
+//==============================================================================
+/** Immutable per-bucket summary of a file (mono mix). */
+struct OverviewData
+{
+    double sampleRate = 44100.0;
+    juce::int64 lengthInSamples = 0;
+    int samplesPerBucket = 1;
+
+    std::vector<float> minValues;
+    std::vector<float> maxValues;
+    std::vector<float> rmsValues;
+    std::vector<float> rideGainDb;      // Mean ride gain per bucket (empty if not rendered)
+
+    juce::int64 rideSettingsHash = 0;
+
+    int getNumBuckets() const { return static_cast<int>(rmsValues.size()); }
+    double getLengthInSeconds() const { return sampleRate > 0.0 ? static_cast<double>(lengthInSamples) / sampleRate : 0.0; }
+};
+
+//==============================================================================
+class OverviewBuilder : private juce::Thread,
+                        private juce::AsyncUpdater
+{
+public:
+    OverviewBuilder();
+    ~OverviewBuilder() override;
+
+    //==============================================================================
+    /** Starts (or restarts) building the overview of a file with the given ride
+        settings. Returns immediately; the result arrives via onOverviewReady.
+    */
+    void build(const juce::File& file, const RideSettings& settings);
+
+    /** Re-renders only the ride preview when the settings differ from the last build */
+    void updateRideSettings(const RideSettings& settings);
+
+    /** Drops the current build without waiting for the worker to wind down */
+    void cancel();
+
+    bool isBuilding() const { return building.load(); }
+    float getProgress() const { return progress.load(); }
+
+    /** Latest completed overview (message thread) */
+    std::shared_ptr<const OverviewData> getOverview() const { return overview; }
+    juce::File getFile() const { return currentFile; }
+
+    /** Called on the message thread whenever a new overview is available */
+    std::function<void()> onOverviewReady;
+
+    //==============================================================================
+    /** Stable hash of the settings that affect the ride preview */
+    static juce::int64 hashSettings(const RideSettings& settings);
+
+    /** Fingerprint of a file's contents (size, modification time and
+        head/middle/tail samples) */
+    static juce::String fingerprintFile(const juce::File& file);
+
+    static juce::File getCacheFolder();
+
+private:
+    //==============================================================================
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    void runJob(const juce::File& file, const RideSettings& settings, bool isNewFile);
+
+    /** True once the running job has been cancelled or replaced (worker thread) */
+    bool shouldStop() const { return threadShouldExit() || runningJob != jobSequence.load(); }
+
+    /** Renders the ride preview, and the waveform summary too unless one is given */
+    std::shared_ptr<OverviewData> analyse(juce::AudioFormatReader& reader, const RideSettings& settings,
+                                          const OverviewData* summary);
+    void publish(std::shared_ptr<OverviewData> result);
+
+    static std::shared_ptr<OverviewData> readSummaryCache(const juce::File& cacheFile);
+    static void writeSummaryCache(const juce::File& cacheFile, const OverviewData& data);
+    static bool readRideCache(const juce::File& cacheFile, OverviewData& data, juce::int64 settingsHash);
+    static void writeRideCache(const juce::File& cacheFile, const OverviewData& data);
+    static void trimCache(const juce::File& folder);
+
+    //==============================================================================
+    juce::AudioFormatManager formatManager;
+
+    // Latest job, handed from the message thread to the worker under jobLock.
+    // Each build or cancel bumps jobSequence, which tells a running job to stop.
+    juce::CriticalSection jobLock;
+    juce::File jobFile;
+    RideSettings jobSettings;
+    bool jobIsNewFile = true;   // Show the waveform before the ride preview is ready
+    bool jobPending = false;
+    std::atomic<int> jobSequence { 0 };
+    int runningJob = 0;         // Worker thread only
+
+    std::atomic<bool> building { false };
+    std::atomic<float> progress { 0.0f };
+
+    // Result hand-off from the worker to the message thread
+    juce::SpinLock resultLock;
+    std::shared_ptr<OverviewData> pendingResult;
+    int pendingResultJob = 0;
+
+    juce::File currentFile;
+    RideSettings currentSettings;
+    std::shared_ptr<const OverviewData> overview;
+
+    static constexpr int maxBuckets = 8192;
+    static constexpr int minSamplesPerBucket = 64;
+    static constexpr int rideBlockSize = 512;      // Simulated host block size for the preview
+    static constexpr int maxCacheFiles = 256;     // Summaries + ride previews
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OverviewBuilder)
+};
@@ -0,0 +1,187 @@
+/*
+  ==============================================================================
+
+    RideRecorder.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "RideRecorder.h"
+
+RideRecorder::RideRecorder()
+{
+}
+
+RideRecorder::~RideRecorder()
+{
+    stop();
+}
+
+//==============================================================================
+juce::File RideRecorder::getGainFileFor(const juce::File& file)
+{
+    return file.getSiblingFile(file.getFileNameWithoutExtension() + "_gain.wav");
+}
+
+std::unique_ptr<juce::AudioFormatWriter> RideRecorder::createWavWriter(const juce::File& file,
+                                                                      double sampleRate,
+                                                                      int numChannels,
+                                                                      int bitsPerSample)
+{
+    // FileOutputStream appends to existing files, so start from scratch
+    if (file.existsAsFile() && !file.deleteFile())
+        return nullptr;
+
+    auto stream = file.createOutputStream();
+    if (stream == nullptr)
+        return nullptr;
+
+    juce::WavAudioFormat wavFormat;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wavFormat.createWriterFor(stream.get(), sampleRate,
+                                  static_cast<unsigned int>(numChannels),
+                                  bitsPerSample, {}, 0));
+
+    if (writer != nullptr)
+        stream.release();  // Writer owns the stream now
+
+    return writer;
+}
+
+//==============================================================================
+bool RideRecorder::start(const juce::File& file, double sampleRate, int numChannels)
+{
+    stop();
+
+    if (sampleRate <= 0.0 || numChannels <= 0)
+        return false;
+
+    file.getParentDirectory().createDirectory();
+
+    auto newGainFile = getGainFileFor(file);
+    auto audio = createWavWriter(file, sampleRate, numChannels, 24);
+    auto gain = createWavWriter(newGainFile, sampleRate, 1, 32);
+
+    if (audio == nullptr || gain == nullptr)
+        return false;
+
+    // Nothing reads these until recording is set below (the writer thread is stopped)
+    audioWriter = std::move(audio);
+    gainWriter = std::move(gain);
+    audioFile = file;
+    gainFile = newGainFile;
+    recordingChannels = numChannels;
+    recordingSampleRate = sampleRate;
+    samplesRecorded.store(0);
+    samplesDropped.store(0);
+
+    fifo.reset();
+    fifoBuffer.setSize(numChannels + 1, fifoSizeSamples);
+    drainChannels.assign(static_cast<size_t>(numChannels), nullptr);
+
+    {
+        const juce::SpinLock::ScopedLockType lock(writerLock);
+        recording.store(true);
+    }
+
+    writerThread.addTimeSliceClient(this);
+    writerThread.startThread();
+    return true;
+}
+
+void RideRecorder::stop()
+{
+    {
+        // Once this is held no push() is in flight, and none will queue more
+        const juce::SpinLock::ScopedLockType lock(writerLock);
+        recording.store(false);
+    }
+
+    writerThread.removeTimeSliceClient(this);
+    writerThread.stopThread(2000);
+
+    if (audioWriter == nullptr)
+        return;
+
+    // Write what is still queued, then finalise the file headers
+    drainFifo();
+    audioWriter.reset();
+    gainWriter.reset();
+}
+
+//==============================================================================
+void RideRecorder::push(const float* const* channelData, int numChannels,
+                        const float* gainDb, int numSamples)
+{
+    if (!recording.load(std::memory_order_relaxed) || numSamples <= 0)
+        return;
+
+    const juce::SpinLock::ScopedTryLockType lock(writerLock);
+    if (!lock.isLocked() || !recording.load(std::memory_order_relaxed))
+        return;  // start/stop is running - skip this block
+
+    // Channel layout changed mid-recording: only write what the file was opened with
+    if (numChannels < recordingChannels)
+    {
+        samplesDropped.fetch_add(numSamples, std::memory_order_relaxed);
+        return;
+    }
+
+    // One FIFO for both streams: the block is queued for both files or for neither
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+    if (size1 + size2 < numSamples)
+    {
+        samplesDropped.fetch_add(numSamples, std::memory_order_relaxed);
+        return;
+    }
+
+    for (int channel = 0; channel < recordingChannels; ++channel)
+    {
+        fifoBuffer.copyFrom(channel, start1, channelData[channel], size1);
+        if (size2 > 0)
+            fifoBuffer.copyFrom(channel, start2, channelData[channel] + size1, size2);
+    }
+
+    // The gain curve rides in the last channel
+    fifoBuffer.copyFrom(recordingChannels, start1, gainDb, size1);
+    if (size2 > 0)
+        fifoBuffer.copyFrom(recordingChannels, start2, gainDb + size1, size2);
+
+    fifo.finishedWrite(numSamples);
+    samplesRecorded.fetch_add(numSamples, std::memory_order_relaxed);
+}
+
+//==============================================================================
+int RideRecorder::useTimeSlice()
+{
+    // Come straight back while there is a backlog, otherwise idle a little
+    return drainFifo() > 0 ? 0 : 20;
+}
+
+int RideRecorder::drainFifo()
+{
+    if (audioWriter == nullptr || gainWriter == nullptr)
+        return 0;
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+
+    for (const auto [start, size] : { std::make_pair(start1, size1), std::make_pair(start2, size2) })
+    {
+        if (size <= 0)
+            continue;
+
+        for (int channel = 0; channel < recordingChannels; ++channel)
+            drainChannels[static_cast<size_t>(channel)] = fifoBuffer.getReadPointer(channel, start);
+        const float* gainChannel[] = { fifoBuffer.getReadPointer(recordingChannels, start) };
+
+        audioWriter->writeFromFloatArrays(drainChannels.data(), recordingChannels, size);
+        gainWriter->writeFromFloatArrays(gainChannel, 1, size);
+    }
+
+    fifo.finishedRead(size1 + size2);
+    return size1 + size2;
+}
@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    RideRecorder.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Records the processed output and the per-sample gain curve to disk.
+    The audio thread only copies into a lock-free FIFO; a background thread
+    drains it to the files, so recordings of any length use bounded memory.
+    Audio and gain share one FIFO, so a block lands in both files or is
+    dropped from both, and the two files never drift apart. The writer thread
+    only runs while recording.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <atomic>
+#include <vector>
+
+class RideRecorder : private juce::TimeSliceClient
+{
+public:
+    RideRecorder();
+    ~RideRecorder() override;
+
+    //==============================================================================
+    /** Opens the output files and starts recording (message thread).
+        The processed audio goes to audioFile as 24-bit WAV; the gain curve is
+        written next to it as "<name>_gain.wav" (mono 32-bit float, dB per sample).
+        WAV files switch to RF64 automatically once they pass 4 GB.
+    */
+    bool start(const juce::File& audioFile, double sampleRate, int numChannels);
+
+    /** Stops recording and flushes everything still in the FIFO (message thread). */
+    void stop();
+
+    bool isRecording() const { return recording.load(); }
+    juce::File getAudioFile() const { return audioFile; }
+    juce::File getGainFile() const { return gainFile; }
+
+    /** Returns the sidecar file that goes with a recorded audio file. */
+    static juce::File getGainFileFor(const juce::File& audioFile);
+
+    //==============================================================================
+    /** Audio thread: queues one block of processed audio plus its gain curve (dB),
+        where gainDb[i] is the gain that was applied to sample i of the block.
+        Never blocks or allocates. If the
+        writer thread falls behind and the FIFO is full, the block is dropped
+        from both files and counted instead.
+    */
+    void push(const float* const* channelData, int numChannels,
+              const float* gainDb, int numSamples);
+
+    juce::int64 getSamplesRecorded() const { return samplesRecorded.load(); }
+    juce::int64 getSamplesDropped() const { return samplesDropped.load(); }
+    double getSampleRate() const { return recordingSampleRate; }
+
+private:
+    //==============================================================================
+    static std::unique_ptr<juce::AudioFormatWriter> createWavWriter(const juce::File& file,
+                                                                    double sampleRate,
+                                                                    int numChannels,
+                                                                    int bitsPerSample);
+
+    int useTimeSlice() override;
+
+    /** Writes everything queued to the files; returns the number of samples written */
+    int drainFifo();
+
+    //==============================================================================
+    juce::TimeSliceThread writerThread { "magic.RIDE Recorder" };
+
+    // Only touched by the writer thread, and by start/stop while it is stopped
+    std::unique_ptr<juce::AudioFormatWriter> audioWriter;
+    std::unique_ptr<juce::AudioFormatWriter> gainWriter;
+    std::vector<const float*> drainChannels;
+
+    // recordingChannels audio channels plus the gain curve in the last channel
+    juce::AbstractFifo fifo { fifoSizeSamples };
+    juce::AudioBuffer<float> fifoBuffer;
+
+    // Guards the recording state. The audio thread only ever try-locks it, so
+    // start/stop can never stall processBlock.
+    juce::SpinLock writerLock;
+
+    std::atomic<bool> recording { false };
+    std::atomic<juce::int64> samplesRecorded { 0 };
+    std::atomic<juce::int64> samplesDropped { 0 };
+
+    juce::File audioFile;
+    juce::File gainFile;
+    int recordingChannels = 0;
+    double recordingSampleRate = 44100.0;
+
+    // ~2.7 s at 48 kHz - plenty for disk hiccups, bounded for long takes
+    static constexpr int fifoSizeSamples = 131072;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RideRecorder)
+};
@@ -0,0 +1,182 @@
+/*
+  ==============================================================================
+
+    MultiRiderEditor.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "MultiRiderEditor.h"
+
+MultiRiderAudioProcessorEditor::MultiRiderAudioProcessorEditor(MultiRiderAudioProcessor& p)
+    : AudioProcessorEditor(&p), audioProcessor(p)
+{
+    setLookAndFeel(&customLookAndFeel);
+
+    auto& apvts = audioProcessor.getApvts();
+
+    speedSlider.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
+    speedSlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
+    speedSlider.setTooltip("Speed (shared by all stems)");
+    addAndMakeVisible(speedSlider);
+    speedAttachment = std::make_unique<SliderAttachment>(apvts, MultiRiderAudioProcessor::speedParamId, speedSlider);
+
+    speedLabel.setText("SPEED", juce::dontSendNotification);
+    speedLabel.setFont(CustomLookAndFeel::getPluginFont(10.0f, true));
+    speedLabel.setColour(juce::Label::textColourId, CustomLookAndFeel::getDimTextColour());
+    speedLabel.setJustificationType(juce::Justification::centredLeft);
+    addAndMakeVisible(speedLabel);
+
+    for (int i = 0; i < MultiRiderAudioProcessor::numStems; ++i)
+    {
+        auto& row = rows[static_cast<size_t>(i)];
+
+        row.nameLabel.setText("Stem " + juce::String(i + 1), juce::dontSendNotification);
+        row.nameLabel.setFont(CustomLookAndFeel::getPluginFont(11.0f, true));
+        row.nameLabel.setColour(juce::Label::textColourId, CustomLookAndFeel::getTextColour());
+        addAndMakeVisible(row.nameLabel);
+
+        for (auto* slider : { &row.targetSlider, &row.rangeSlider })
+        {
+            slider->setSliderStyle(juce::Slider::LinearHorizontal);
+            slider->setTextBoxStyle(juce::Slider::TextBoxRight, false, 56, 18);
+            slider->setTextValueSuffix(" dB");
+            addAndMakeVisible(*slider);
+        }
+
+        row.targetSlider.setTooltip("Target level");
+        row.rangeSlider.setTooltip("Range (max boost and cut)");
+        row.targetAttachment = std::make_unique<SliderAttachment>(apvts, MultiRiderAudioProcessor::getStemTargetParamId(i), row.targetSlider);
+        row.rangeAttachment = std::make_unique<SliderAttachment>(apvts, MultiRiderAudioProcessor::getStemRangeParamId(i), row.rangeSlider);
+    }
+
+    setSize(620, headerHeight + rowHeight * MultiRiderAudioProcessor::numStems + 12);
+    timerCallback();
+    startTimerHz(30);
+}
+
+MultiRiderAudioProcessorEditor::~MultiRiderAudioProcessorEditor()
+{
+    stopTimer();
+    setLookAndFeel(nullptr);
+}
+
+//==============================================================================
+void MultiRiderAudioProcessorEditor::timerCallback()
+{
+    for (int i = 0; i < MultiRiderAudioProcessor::numStems; ++i)
+    {
+        auto& row = rows[static_cast<size_t>(i)];
+
+        const bool active = audioProcessor.isStemActive(i);
+        if (active != row.active)
+        {
+            // Dim rows for buses the host hasn't enabled
+            row.active = active;
+            const float alpha = active ? 1.0f : 0.35f;
+            row.nameLabel.setAlpha(alpha);
+            row.targetSlider.setAlpha(alpha);
+            row.rangeSlider.setAlpha(alpha);
+            repaint(row.meterBounds);
+        }
+
+        const float gainDb = active ? audioProcessor.getStemGainDb(i) : 0.0f;
+        if (std::abs(gainDb - row.gainDb) > 0.05f)
+        {
+            row.gainDb = gainDb;
+            repaint(row.meterBounds);
+        }
+    }
+}
+
+//==============================================================================
+void MultiRiderAudioProcessorEditor::paint(juce::Graphics& g)
+{
+    g.fillAll(CustomLookAndFeel::getBackgroundColour());
+    CustomLookAndFeel::drawGrainTexture(g, getLocalBounds());
+
+    // Header
+    auto titleArea = headerBounds.reduced(16, 0);
+    g.setColour(CustomLookAndFeel::getTextColour());
+    g.setFont(CustomLookAndFeel::getBrandFont(20.0f));
+    g.drawText("magic.RIDE", titleArea.removeFromLeft(140), juce::Justification::centredLeft);
+    g.setColour(CustomLookAndFeel::getAccentColour());
+    g.setFont(CustomLookAndFeel::getPluginFont(12.0f, true));
+    g.drawText("MULTI", titleArea.removeFromLeft(60), juce::Justification::centredLeft);
+
+    // Column captions
+    auto captions = headerBounds.withTrimmedTop(headerBounds.getHeight() - 16).reduced(16, 0);
+    g.setColour(CustomLookAndFeel::getVeryDimTextColour());
+    g.setFont(CustomLookAndFeel::getPluginFont(9.0f, true));
+    captions.removeFromLeft(70);
+    const int sliderWidth = (captions.getWidth() - 140) / 2;
+    g.drawText("TARGET", captions.removeFromLeft(sliderWidth), juce::Justification::centredLeft);
+    g.drawText("RANGE", captions.removeFromLeft(sliderWidth).withTrimmedLeft(8), juce::Justification::centredLeft);
+    g.drawText("RIDE", captions.withTrimmedLeft(8), juce::Justification::centredLeft);
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        const auto& row = rows[i];
+
+        if (i % 2 == 1)
+        {
+            g.setColour(CustomLookAndFeel::getSurfaceColour().withAlpha(0.4f));
+            g.fillRect(row.rowBounds);
+        }
+
+        drawGainMeter(g, row);
+    }
+}
+
+void MultiRiderAudioProcessorEditor::drawGainMeter(juce::Graphics& g, const StemRow& row) const
+{
+    auto bounds = row.meterBounds.toFloat();
+    CustomLookAndFeel::drawNeumorphicInset(g, bounds, 3.0f);
+
+    const float alpha = row.active ? 1.0f : 0.35f;
+    auto bar = bounds.reduced(2.0f);
+    const float centreX = bar.getCentreX();
+
+    // Centre-zero bar: boost to the right, cut to the left
+    const float proportion = juce::jlimit(-1.0f, 1.0f, row.gainDb / meterRangeDb);
+    const float barWidth = std::abs(proportion) * bar.getWidth() * 0.5f;
+    const auto colour = row.gainDb >= 0.0f ? CustomLookAndFeel::getGainCurveColour()
+                                           : CustomLookAndFeel::getGainCutColour();
+    g.setColour(colour.withMultipliedAlpha(alpha));
+    g.fillRect(proportion >= 0.0f ? bar.withX(centreX).withWidth(barWidth)
+                                  : bar.withX(centreX - barWidth).withWidth(barWidth));
+
+    g.setColour(CustomLookAndFeel::getRangeLineColour().withMultipliedAlpha(alpha));
+    g.drawVerticalLine(juce::roundToInt(centreX), bar.getY(), bar.getBottom());
+
+    g.setColour(CustomLookAndFeel::getTextColour().withMultipliedAlpha(alpha));
+    g.setFont(CustomLookAndFeel::getPluginFont(9.0f));
+    g.drawText((row.gainDb > 0.0f ? "+" : "") + juce::String(row.gainDb, 1),
+               bar.reduced(4.0f, 0.0f), row.gainDb >= 0.0f ? juce::Justification::centredLeft
+                                                           : juce::Justification::centredRight);
+}
+
+void MultiRiderAudioProcessorEditor::resized()
+{
+    auto area = getLocalBounds();
+    headerBounds = area.removeFromTop(headerHeight);
+
+    auto speedArea = headerBounds.reduced(16, 8).removeFromRight(130);
+    speedLabel.setBounds(speedArea.removeFromLeft(50));
+    speedSlider.setBounds(speedArea.withSizeKeepingCentre(48, 48));
+
+    area = area.reduced(16, 0);
+    for (auto& row : rows)
+    {
+        auto rowArea = area.removeFromTop(rowHeight);
+        row.rowBounds = rowArea.expanded(16, 0);
+        row.nameLabel.setBounds(rowArea.removeFromLeft(70));
+
+        const int sliderWidth = (rowArea.getWidth() - 140) / 2;
+        row.targetSlider.setBounds(rowArea.removeFromLeft(sliderWidth).reduced(0, 6));
+        row.rangeSlider.setBounds(rowArea.removeFromLeft(sliderWidth).withTrimmedLeft(8).reduced(0, 6));
+        row.meterBounds = rowArea.withTrimmedLeft(8).reduced(0, 9);
+    }
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    MultiRiderEditor.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Compact editor for magic.RIDE Multi: the shared speed knob and one row
+    per stem (target, range and a live ride gain meter). Rows for disabled
+    buses are dimmed.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include <memory>
+#include "MultiRiderProcessor.h"
+#include "UI/CustomLookAndFeel.h"
+
+//==============================================================================
+class MultiRiderAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                       private juce::Timer
+{
+public:
+    explicit MultiRiderAudioProcessorEditor(MultiRiderAudioProcessor&);
+    ~MultiRiderAudioProcessorEditor() override;
+
+    //==============================================================================
+    void paint(juce::Graphics&) override;
+    void resized() override;
+
+private:
+    void timerCallback() override;
+
+    using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+
+    struct StemRow
+    {
+        juce::Label nameLabel;
+        juce::Slider targetSlider, rangeSlider;
+        std::unique_ptr<SliderAttachment> targetAttachment, rangeAttachment;
+        juce::Rectangle<int> rowBounds, meterBounds;
+        float gainDb = 0.0f;
+        bool active = true;   // First timer tick dims disabled buses
+    };
+
+    void drawGainMeter(juce::Graphics& g, const StemRow& row) const;
+
+    //==============================================================================
+    MultiRiderAudioProcessor& audioProcessor;
+    CustomLookAndFeel customLookAndFeel;
+
+    juce::Slider speedSlider;
+    juce::Label speedLabel;
+    std::unique_ptr<SliderAttachment> speedAttachment;
+
+    std::array<StemRow, MultiRiderAudioProcessor::numStems> rows;
+    juce::Rectangle<int> headerBounds;
+
+    static constexpr int headerHeight = 72;
+    static constexpr int rowHeight = 34;
+    static constexpr float meterRangeDb = 12.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiRiderAudioProcessorEditor)
+};
@@ -0,0 +1,206 @@
+/*
+  ==============================================================================
+
+    MultiRiderProcessor.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "MultiRiderProcessor.h"
+#include "MultiRiderEditor.h"
+
+//==============================================================================
+const juce::String MultiRiderAudioProcessor::speedParamId = "speed";
+
+namespace
+{
+    juce::AudioProcessor::BusesProperties createStemBuses()
+    {
+        juce::AudioProcessor::BusesProperties buses;
+
+        // Stem 1 is the main bus; the rest are enabled by the host as needed
+        for (int i = 0; i < MultiRiderAudioProcessor::numStems; ++i)
+        {
+            const juce::String name = "Stem " + juce::String(i + 1);
+            buses = buses.withInput(name, juce::AudioChannelSet::stereo(), i == 0)
+                         .withOutput(name, juce::AudioChannelSet::stereo(), i == 0);
+        }
+
+        return buses;
+    }
+}
+
+//==============================================================================
+MultiRiderAudioProcessor::MultiRiderAudioProcessor()
+    : AudioProcessor(createStemBuses()),
+      apvts(*this, nullptr, "Parameters", createParameterLayout())
+{
+    // Cache parameter pointers for real-time access
+    speedParam = apvts.getRawParameterValue(speedParamId);
+    for (int i = 0; i < numStems; ++i)
+    {
+        stemTargetParams[static_cast<size_t>(i)] = apvts.getRawParameterValue(getStemTargetParamId(i));
+        stemRangeParams[static_cast<size_t>(i)] = apvts.getRawParameterValue(getStemRangeParamId(i));
+    }
+}
+
+MultiRiderAudioProcessor::~MultiRiderAudioProcessor()
+{
+}
+
+//==============================================================================
+juce::AudioProcessorValueTreeState::ParameterLayout MultiRiderAudioProcessor::createParameterLayout()
+{
+    std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
+
+    // Speed: 0-100%, shared by every stem
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID(speedParamId, 1),
+        "Speed",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f),
+        50.0f,
+        juce::AudioParameterFloatAttributes().withLabel("%")
+    ));
+
+    for (int i = 0; i < numStems; ++i)
+    {
+        const juce::String stemName = "Stem " + juce::String(i + 1);
+
+        // Target Level: -40 to 0 dB, default -18 dB
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID(getStemTargetParamId(i), 1),
+            stemName + " Target",
+            juce::NormalisableRange<float>(-40.0f, 0.0f, 0.1f),
+            -18.0f,
+            juce::AudioParameterFloatAttributes().withLabel("dB")
+        ));
+
+        // Range: 0 to 12 dB either way, default 6 dB
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID(getStemRangeParamId(i), 1),
+            stemName + " Range",
+            juce::NormalisableRange<float>(0.0f, 12.0f, 0.1f),
+            6.0f,
+            juce::AudioParameterFloatAttributes().withLabel("dB")
+        ));
+    }
+
+    return { params.begin(), params.end() };
+}
+
+//==============================================================================
+const juce::String MultiRiderAudioProcessor::getName() const
+{
+    return JucePlugin_Name;
+}
+
+bool MultiRiderAudioProcessor::acceptsMidi() const { return false; }
+bool MultiRiderAudioProcessor::producesMidi() const { return false; }
+bool MultiRiderAudioProcessor::isMidiEffect() const { return false; }
+double MultiRiderAudioProcessor::getTailLengthSeconds() const { return 0.0; }
+
+int MultiRiderAudioProcessor::getNumPrograms() { return 1; }
+int MultiRiderAudioProcessor::getCurrentProgram() { return 0; }
+void MultiRiderAudioProcessor::setCurrentProgram(int) {}
+const juce::String MultiRiderAudioProcessor::getProgramName(int) { return {}; }
+void MultiRiderAudioProcessor::changeProgramName(int, const juce::String&) {}
+
+//==============================================================================
+void MultiRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+    rideBank.prepare(sampleRate, samplesPerBlock);
+}
+
+void MultiRiderAudioProcessor::releaseResources()
+{
+}
+
+bool MultiRiderAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // The main stem can't be switched off
+    if (layouts.getMainOutputChannelSet().isDisabled())
+        return false;
+
+    for (int i = 0; i < layouts.outputBuses.size(); ++i)
+    {
+        const auto outputSet = layouts.getChannelSet(false, i);
+
+        // Each stem can be mono, stereo, or disabled, and must be processed in place
+        if (!outputSet.isDisabled()
+            && outputSet != juce::AudioChannelSet::mono()
+            && outputSet != juce::AudioChannelSet::stereo())
+            return false;
+
+        if (i >= layouts.inputBuses.size() || layouts.getChannelSet(true, i) != outputSet)
+            return false;
+    }
+
+    return true;
+}
+
+bool MultiRiderAudioProcessor::isStemActive(int stem) const
+{
+    const auto* bus = getBus(false, stem);
+    return bus != nullptr && bus->isEnabled();
+}
+
+//==============================================================================
+void MultiRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    juce::ScopedNoDenormals noDenormals;
+
+    const int numSamples = buffer.getNumSamples();
+
+    rideBank.setSpeed(speedParam->load());
+
+    std::array<StemRideBank::StemChannels, numStems> stems {};
+    const int numBuses = juce::jmin(numStems, getBusCount(false));
+
+    for (int i = 0; i < numBuses; ++i)
+    {
+        const auto idx = static_cast<size_t>(i);
+        rideBank.setStemTarget(i, stemTargetParams[idx]->load());
+        rideBank.setStemRange(i, stemRangeParams[idx]->load());
+
+        // Input and output layouts match, so each stem is ridden in place
+        auto stemBuffer = getBusBuffer(buffer, false, i);
+        if (stemBuffer.getNumChannels() > 0)
+            stems[idx].left = stemBuffer.getWritePointer(0);
+        if (stemBuffer.getNumChannels() > 1)
+            stems[idx].right = stemBuffer.getWritePointer(1);
+    }
+
+    rideBank.process(stems.data(), numBuses, numSamples);
+}
+
+//==============================================================================
+bool MultiRiderAudioProcessor::hasEditor() const { return true; }
+
+juce::AudioProcessorEditor* MultiRiderAudioProcessor::createEditor()
+{
+    return new MultiRiderAudioProcessorEditor(*this);
+}
+
+//==============================================================================
+void MultiRiderAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    auto state = apvts.copyState();
+    std::unique_ptr<juce::XmlElement> xml(state.createXml());
+    copyXmlToBinary(*xml, destData);
+}
+
+void MultiRiderAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
+{
+    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+
+    if (xmlState != nullptr && xmlState->hasTagName(apvts.state.getType()))
+        apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+//==============================================================================
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new MultiRiderAudioProcessor();
+}
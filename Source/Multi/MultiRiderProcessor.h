@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    MultiRiderProcessor.h
+    Created: 2026
+    Author:  MBM Audio
+
+    magic.RIDE Multi: one instance riding up to 8 mono or stereo stems, each
+    on its own input/output bus pair. Every stem has its own target and
+    range; speed is shared. The ride itself is StemRideBank.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <array>
+#include "DSP/StemRideBank.h"
+
+//==============================================================================
+class MultiRiderAudioProcessor : public juce::AudioProcessor
+{
+public:
+    static constexpr int numStems = StemRideBank::maxStems;
+
+    //==============================================================================
+    MultiRiderAudioProcessor();
+    ~MultiRiderAudioProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
+
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override;
+
+    //==============================================================================
+    const juce::String getName() const override;
+
+    bool acceptsMidi() const override;
+    bool producesMidi() const override;
+    bool isMidiEffect() const override;
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    int getNumPrograms() override;
+    int getCurrentProgram() override;
+    void setCurrentProgram(int index) override;
+    const juce::String getProgramName(int index) override;
+    void changeProgramName(int index, const juce::String& newName) override;
+
+    //==============================================================================
+    void getStateInformation(juce::MemoryBlock& destData) override;
+    void setStateInformation(const void* data, int sizeInBytes) override;
+
+    //==============================================================================
+    juce::AudioProcessorValueTreeState& getApvts() { return apvts; }
+
+    // Parameter IDs
+    static const juce::String speedParamId;
+    static juce::String getStemTargetParamId(int stem) { return "stem" + juce::String(stem + 1) + "_target"; }
+    static juce::String getStemRangeParamId(int stem)  { return "stem" + juce::String(stem + 1) + "_range"; }
+
+    // Metering (thread-safe)
+    float getStemGainDb(int stem) const { return rideBank.getStemGainDb(stem); }
+    bool isStemActive(int stem) const;
+
+private:
+    //==============================================================================
+    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+    juce::AudioProcessorValueTreeState apvts;
+
+    std::atomic<float>* speedParam = nullptr;
+    std::array<std::atomic<float>*, numStems> stemTargetParams {};
+    std::array<std::atomic<float>*, numStems> stemRangeParams {};
+
+    StemRideBank rideBank;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiRiderAudioProcessor)
+};
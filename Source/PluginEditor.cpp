@@ -12,6 +12,8 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "IO/GainCurveReader.h"
+#include "IO/GainCurveWriter.h"
 #include <map>
 
 //==============================================================================
@@ -20,8 +22,6 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
       audioProcessor(p)
 {
     setLookAndFeel(&customLookAndFeel);
-    // Disable manual resizing - only allow preset sizes
-    setResizable(false, false);
     // Enable keyboard focus for shortcuts (Cmd+Z, etc.)
     setWantsKeyboardFocus(true);
 
@@ -133,16 +133,23 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
     abCompareButton.onClick = [this] {
         if (abCompareButton.getToggleState()) {
             // Switching to B - save current state as A, apply B
+            // Parameters first, so no block can swap while they still hold A
             stateA = getCurrentState();
             applyState(stateB);
+            if (audioProcessor.isShadowEngineEnabled())
+                audioProcessor.swapWithShadow(getRideSettingsFor(stateA));
             isStateB = true;
         } else {
             // Switching to A - save current state as B, apply A
             stateB = getCurrentState();
             applyState(stateA);
+            if (audioProcessor.isShadowEngineEnabled())
+                audioProcessor.swapWithShadow(getRideSettingsFor(stateB));
             isStateB = false;
         }
     };
+    abCompareButton.onRightClick = [this] { showABCompareMenu(); };
+    abCompareButton.setSeamless(audioProcessor.isShadowEngineEnabled());
     addAndMakeVisible(abCompareButton);
     
     // Undo button
@@ -181,9 +188,12 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
     addAndMakeVisible(waveformDisplay);
     audioProcessor.setWaveformDisplay(&waveformDisplay);
     
+    // Handle drags also re-render the ride over the visible history (what-if
+    // preview); the result is applied to the display in timerCallback
     waveformDisplay.onTargetChanged = [this](float newTarget) {
         if (auto* param = audioProcessor.getApvts().getParameter(VocalRiderAudioProcessor::targetLevelParamId))
             param->setValueNotifyingHost(param->convertTo0to1(newTarget));
+        audioProcessor.requestRidePreview();
     };
     
     waveformDisplay.onRangeChanged = [this](float newRange) {
@@ -193,16 +203,19 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
             param->setValueNotifyingHost(param->convertTo0to1(newRange));
         if (auto* param = audioProcessor.getApvts().getParameter(VocalRiderAudioProcessor::cutRangeParamId))
             param->setValueNotifyingHost(param->convertTo0to1(newRange));
+        audioProcessor.requestRidePreview();
     };
     
     waveformDisplay.onBoostRangeChanged = [this](float newRange) {
         if (auto* param = audioProcessor.getApvts().getParameter(VocalRiderAudioProcessor::boostRangeParamId))
             param->setValueNotifyingHost(param->convertTo0to1(newRange));
+        audioProcessor.requestRidePreview();
     };
     
     waveformDisplay.onCutRangeChanged = [this](float newRange) {
         if (auto* param = audioProcessor.getApvts().getParameter(VocalRiderAudioProcessor::cutRangeParamId))
             param->setValueNotifyingHost(param->convertTo0to1(newRange));
+        audioProcessor.requestRidePreview();
     };
     
     waveformDisplay.setRangeLocked(audioProcessor.isRangeLocked());
@@ -218,6 +231,38 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
         }
     );
 
+    #if JucePlugin_Build_Standalone
+    // Overview strip (shown once a file is dropped onto the Standalone)
+    addChildComponent(overviewStrip);
+    overviewStrip.onSeek = [this](double seconds) {
+        audioProcessor.setPlaybackPosition(seconds);
+        if (!audioProcessor.hasLoopRegion())
+            overviewStrip.clearLoopRegion();
+    };
+    overviewStrip.onLoopRegionChanged = [this](double startSeconds, double endSeconds) {
+        audioProcessor.setLoopRegion(startSeconds, endSeconds);
+        if (audioProcessor.hasLoopRegion())
+        {
+            const auto& loop = audioProcessor.getLoopRenderer();
+            overviewStrip.setLoopRegion(loop.getStartSeconds(), loop.getEndSeconds());
+            setStatusBarText("Looping " + juce::String(loop.getEndSeconds() - loop.getStartSeconds(), 1)
+                             + " s - changes are re-rendered each pass (Shift-click to clear)");
+        }
+        else
+        {
+            overviewStrip.clearLoopRegion();
+        }
+        
+        // Too long to hold in RAM: the previous loop (if any) stays
+        if (endSeconds - startSeconds > LoopRenderer::maxRegionSeconds)
+            setStatusBarText("Loop regions are limited to "
+                             + juce::String(juce::roundToInt(LoopRenderer::maxRegionSeconds / 60.0)) + " minutes");
+    };
+    overviewStrip.onLoopCleared = [this] {
+        audioProcessor.clearLoopRegion();
+    };
+    #endif
+
     //==============================================================================
     // Control Panel (floating tab)
     
@@ -357,6 +402,7 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
         {
             audioProcessor.updateAttackReleaseFromSpeed(static_cast<float>(speedSlider.getValue()), true);
             if (advancedPanelVisible) updateAdvancedControls();
+            audioProcessor.requestRidePreview();
         }
         if (speedSlider.isMouseOverOrDragging()) {
             valueTooltip.showValue("SPEED", juce::String(static_cast<int>(speedSlider.getValue())) + "%", &speedSlider);
@@ -812,14 +858,33 @@ VocalRiderAudioProcessorEditor::VocalRiderAudioProcessorEditor(VocalRiderAudioPr
     setupAdvLabel(sidechainOffsetLabel, "SC OFFSET");
     sidechainOffsetLabel.setVisible(false);
 
-    // Restore window size from saved state (default to Medium)
+    // Chrome re-rendered in the background after a resize
+    chromeRenderer.onLayerReady = [this](int, const CachedLayer& layer) {
+        cachedChrome = layer;
+        repaint();
+    };
+    
+    // Restore window size from saved state (default to Medium). Read before
+    // the resize limits are set: applying them resizes, which overwrites it.
     int savedSizeIndex = audioProcessor.getWindowSizeIndex();
+    int savedWidth = audioProcessor.getEditorWidth();
+    int savedHeight = audioProcessor.getEditorHeight();
+    
+    // Freely resizable (host or corner resizer) between Small and the max size;
+    // the size menu still offers the presets
+    setResizable(true, true);
+    updateResizeLimits();
+    
     switch (savedSizeIndex)
     {
         case 0: setWindowSize(WindowSize::Small); break;
         case 2: setWindowSize(WindowSize::Large); break;
         default: setWindowSize(WindowSize::Medium); break;
     }
+    
+    if (savedWidth > 0 && savedHeight > 0)
+        setSize(static_cast<int>(juce::jlimit(smallWidth, maxWidth, savedWidth) * uiScaleFactor),
+                static_cast<int>(juce::jlimit(smallHeight, maxHeight, savedHeight) * uiScaleFactor));
     startTimerHz(30);
     updateAdvancedControls();
 
@@ -1445,26 +1510,14 @@ void VocalRiderAudioProcessorEditor::setWindowSize(WindowSize size)
 
 void VocalRiderAudioProcessorEditor::setScale(int scalePercent)
 {
+    // Keep the current (possibly dragged) size, not the last preset
+    const float oldScale = uiScaleFactor;
+    const int baseWidth = juce::roundToInt(static_cast<float>(getWidth()) / oldScale);
+    const int baseHeight = juce::roundToInt(static_cast<float>(getHeight()) / oldScale);
+    
     uiScaleFactor = scalePercent / 100.0f;
     resizeButton.currentScale = scalePercent;
-    
-    // Recalculate size based on current window preset and new scale
-    int baseWidth = mediumWidth, baseHeight = mediumHeight;
-    switch (currentWindowSize)
-    {
-        case WindowSize::Small:
-            baseWidth = smallWidth;
-            baseHeight = smallHeight;
-            break;
-        case WindowSize::Medium:
-            baseWidth = mediumWidth;
-            baseHeight = mediumHeight;
-            break;
-        case WindowSize::Large:
-            baseWidth = largeWidth;
-            baseHeight = largeHeight;
-            break;
-    }
+    updateResizeLimits();
     
     setSize(static_cast<int>(baseWidth * uiScaleFactor), static_cast<int>(baseHeight * uiScaleFactor));
     
@@ -1476,7 +1529,56 @@ void VocalRiderAudioProcessorEditor::setScale(int scalePercent)
 //==============================================================================
 void VocalRiderAudioProcessorEditor::paint(juce::Graphics& g)
 {
-    auto bounds = getLocalBounds().toFloat();
+    // Static chrome is cached at device resolution (display scale x setScale
+    // transform), so this is one pixel-aligned blit. Repaints triggered by
+    // animated children only ever copy their own rectangle from it. After a
+    // resize the old image is stretched over the window until the background
+    // render for the new size lands, so dragging the corner never waits on it.
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (cachedChrome.isNull())
+    {
+        cachedChrome = LayerRenderer::render(getLocalBounds(), pixelScale,
+                                             [layout = getChromeLayout()](juce::Graphics& lg) { paintChrome(lg, layout); });
+        chromeNeedsRedraw = false;
+    }
+    else if (chromeNeedsRedraw || !cachedChrome.matches(getLocalBounds(), pixelScale))
+    {
+        chromeRenderer.request(chromeLayer, getLocalBounds(), pixelScale,
+                               [layout = getChromeLayout()](juce::Graphics& lg) { paintChrome(lg, layout); });
+        chromeNeedsRedraw = false;
+    }
+    
+    cachedChrome.draw(g, getLocalBounds());
+
+#if MAGICRIDE_LITE
+    // AUTO-TARGET badge background (pulsing rounded rect)
+    if (autoTargetBadgeLabel.isVisible())
+    {
+        auto badgeBounds = autoTargetBadgeLabel.getBounds().toFloat().expanded(4.0f, 2.0f);
+        float alpha = autoTargetBadgeLabel.getAlpha();
+        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.12f * alpha));
+        g.fillRoundedRectangle(badgeBounds, 4.0f);
+        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.4f * alpha));
+        g.drawRoundedRectangle(badgeBounds, 4.0f, 1.0f);
+    }
+#endif
+}
+
+VocalRiderAudioProcessorEditor::ChromeLayout VocalRiderAudioProcessorEditor::getChromeLayout() const
+{
+    ChromeLayout layout;
+    layout.bounds = getLocalBounds();
+    layout.bottomBarBounds = bottomBar.getBounds();
+#if MAGICRIDE_LITE
+    layout.upgradeStripBounds = upgradeStripLabel.getBounds();
+#endif
+    return layout;
+}
+
+void VocalRiderAudioProcessorEditor::paintChrome(juce::Graphics& g, const ChromeLayout& layout)
+{
+    // Runs on the chrome render thread: only the captured layout may be used
+    auto bounds = layout.bounds.toFloat();
     float cornerRadius = 12.0f;  // Rounded corners
     
     // Clip to rounded rectangle for rounded corners effect
@@ -1487,23 +1589,17 @@ void VocalRiderAudioProcessorEditor::paint(juce::Graphics& g)
     // Base background with subtle texture
     g.fillAll(CustomLookAndFeel::getBackgroundColour());
     
-    // Cached noise texture for brushed metal feel (regenerated only on resize)
-    if (cachedNoiseTexture.isNull() || cachedNoiseTexture.getWidth() != getWidth() || cachedNoiseTexture.getHeight() != getHeight())
+    // Noise texture for brushed metal feel
+    juce::Random rng(123);
+    g.setColour(juce::Colours::white.withAlpha(0.02f));
+    for (int y = 0; y < layout.bounds.getHeight(); y += 4)
     {
-        cachedNoiseTexture = juce::Image(juce::Image::ARGB, getWidth(), getHeight(), true);
-        juce::Graphics noiseG(cachedNoiseTexture);
-        juce::Random rng(123);
-        noiseG.setColour(juce::Colours::white.withAlpha(0.02f));
-        for (int y = 0; y < getHeight(); y += 4)
+        for (int x = 0; x < layout.bounds.getWidth(); x += 4)
         {
-            for (int x = 0; x < getWidth(); x += 4)
-            {
-                if (rng.nextFloat() > 0.75f)
-                    noiseG.fillRect(x, y, 2, 2);
-            }
+            if (rng.nextFloat() > 0.75f)
+                g.fillRect(x, y, 2, 2);
         }
     }
-    g.drawImageAt(cachedNoiseTexture, 0, 0);
     
     //==========================================================================
     // FabFilter-style header bar
@@ -1585,7 +1681,7 @@ void VocalRiderAudioProcessorEditor::paint(juce::Graphics& g)
     g.fillRect(bounds.getX(), bounds.getBottom() - bottomVignetteHeight, bounds.getWidth(), bottomVignetteHeight);
     
     // Bottom bar - very subtle, integrated with meter area
-    auto bottomBounds = bottomBar.getBounds().toFloat();
+    auto bottomBounds = layout.bottomBarBounds.toFloat();
     
     // Subtle dark gradient from transparent to dark at bottom
     juce::ColourGradient bottomBarGradient(
@@ -1601,35 +1697,50 @@ void VocalRiderAudioProcessorEditor::paint(juce::Graphics& g)
     g.drawHorizontalLine(static_cast<int>(bottomBounds.getY()), 0.0f, bounds.getWidth());
 
 #if MAGICRIDE_LITE
-    // AUTO-TARGET badge background (pulsing rounded rect)
-    if (autoTargetBadgeLabel.isVisible())
-    {
-        auto badgeBounds = autoTargetBadgeLabel.getBounds().toFloat().expanded(4.0f, 2.0f);
-        float alpha = autoTargetBadgeLabel.getAlpha();
-        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.12f * alpha));
-        g.fillRoundedRectangle(badgeBounds, 4.0f);
-        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.4f * alpha));
-        g.drawRoundedRectangle(badgeBounds, 4.0f, 1.0f);
-    }
-
     // Upgrade strip — subtle accent-tinted bar at the very bottom
     {
-        auto stripBounds = upgradeStripLabel.getBounds().toFloat();
+        auto stripBounds = layout.upgradeStripBounds.toFloat();
         g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.06f));
         g.fillRect(stripBounds);
         g.setColour(CustomLookAndFeel::getBorderColour().withAlpha(0.2f));
         g.drawHorizontalLine(static_cast<int>(stripBounds.getY()), 0.0f,
-                             static_cast<float>(getWidth()));
+                             static_cast<float>(layout.bounds.getWidth()));
     }
 #endif
     
     // Advanced panel is now painted by its own component (AdvancedPanelComponent)
 }
 
+void VocalRiderAudioProcessorEditor::updateResizeLimits()
+{
+    setResizeLimits(static_cast<int>(smallWidth * uiScaleFactor), static_cast<int>(smallHeight * uiScaleFactor),
+                    static_cast<int>(maxWidth * uiScaleFactor), static_cast<int>(maxHeight * uiScaleFactor));
+}
+
 void VocalRiderAudioProcessorEditor::resized()
 {
+    chromeNeedsRedraw = true;
+    
+    // Remember dragged sizes in the session, and tick the matching preset (if any)
+    const int logicalWidth = juce::roundToInt(static_cast<float>(getWidth()) / uiScaleFactor);
+    const int logicalHeight = juce::roundToInt(static_cast<float>(getHeight()) / uiScaleFactor);
+    if (logicalWidth > 0 && logicalHeight > 0)
+        audioProcessor.setEditorSize(logicalWidth, logicalHeight);
+    
+    if (logicalWidth == smallWidth && logicalHeight == smallHeight)
+        resizeButton.currentSize = 0;
+    else if (logicalWidth == mediumWidth && logicalHeight == mediumHeight)
+        resizeButton.currentSize = 1;
+    else if (logicalWidth == largeWidth && logicalHeight == largeHeight)
+        resizeButton.currentSize = 2;
+    else
+        resizeButton.currentSize = -1;  // Custom size
+    
     auto bounds = getLocalBounds();
     
+    if (instanceDashboard != nullptr)
+        instanceDashboard->setBounds(bounds);
+    
     //==========================================================================
     // FabFilter-style header bar (compact height)
     int headerHeight = 52;  // Compact header
@@ -1699,6 +1810,16 @@ void VocalRiderAudioProcessorEditor::resized()
     auto bottomArea = bounds.removeFromBottom(bottomBarHeight);
     bottomBar.setBounds(bottomArea);
     
+    // Standalone file overview sits directly above the bottom bar
+    int overviewHeight = 0;
+    #if JucePlugin_Build_Standalone
+    if (overviewStrip.isVisible())
+    {
+        overviewHeight = overviewStripHeight;
+        overviewStrip.setBounds(bounds.removeFromBottom(overviewHeight));
+    }
+    #endif
+    
     // Left side: Footer label (version / status bar help text)
     footerLabel.setBounds(bottomArea.getX() + 8, bottomArea.getY() + 5, 200, 16);
     
@@ -1722,13 +1843,14 @@ void VocalRiderAudioProcessorEditor::resized()
     int autoModeH = 18;
     int autoLabelW = 30;
     int resizeSize = 14;
-    int autoModeX = bottomArea.getWidth() - autoModeW - resizeSize - 16;
+    int cornerResizerSize = 18;  // Clear of the window's corner resize handle
+    int autoModeX = bottomArea.getWidth() - autoModeW - resizeSize - 16 - cornerResizerSize;
     automationModeComboBox.setBounds(autoModeX, toggleY, autoModeW, autoModeH);
     automationLabel.setBounds(autoModeX - autoLabelW - 4, toggleY, autoLabelW, autoModeH);
     
     // Resize button in bottom right corner (smaller icon)
     // Note: resizeButton is a child of bottomBar, so use local coordinates
-    resizeButton.setBounds(bottomArea.getWidth() - resizeSize - 8, 4, resizeSize, resizeSize);
+    resizeButton.setBounds(bottomArea.getWidth() - resizeSize - 8 - cornerResizerSize, 4, resizeSize, resizeSize);
 
 #if MAGICRIDE_LITE
     // Upgrade strip — centered at the bottom of the extended bottom bar
@@ -1834,7 +1956,7 @@ void VocalRiderAudioProcessorEditor::resized()
     }
     
     // Waveform fills area below header and above bottom bar (transparent control area)
-    auto waveformBounds = getLocalBounds().withTrimmedTop(headerHeight).withTrimmedBottom(bottomBarHeight);
+    auto waveformBounds = getLocalBounds().withTrimmedTop(headerHeight).withTrimmedBottom(bottomBarHeight + overviewHeight);
     waveformDisplay.setBounds(waveformBounds);
     
     // Control panel contents - PROPORTIONALLY BIGGER knobs for -60dB range
@@ -1945,6 +2067,18 @@ void VocalRiderAudioProcessorEditor::timerCallback()
     waveformDisplay.setSidechainLevel(audioProcessor.getSidechainLevelDb());
     waveformDisplay.setSidechainActive(audioProcessor.isSidechainEnabled());
     
+    // What-if ride preview finished since the last tick
+    if (auto preview = audioProcessor.getLatestRidePreview(); preview != nullptr && preview->sequence != lastRidePreviewSequence)
+    {
+        lastRidePreviewSequence = preview->sequence;
+        
+        // Audio has kept scrolling in while the preview rendered
+        const auto framesSince = audioProcessor.getRideHistoryFramesWritten() - preview->endFrame;
+        waveformDisplay.applyGainPreview(preview->gainDb, preview->frameRate,
+                                         static_cast<double>(juce::jmax(static_cast<juce::int64>(0), framesSince))
+                                             / preview->frameRate);
+    }
+    
     // Natural Mode indicator: label visible when toggle is ON,
     // green dot reflects actual phrase detection from audio thread
     bool naturalEnabled = audioProcessor.isNaturalModeEnabled();
@@ -2150,7 +2284,17 @@ void VocalRiderAudioProcessorEditor::timerCallback()
         valueTooltip.hideTooltip();
     }
     
-
+    #if JucePlugin_Build_Standalone
+    // Overview playhead + ride preview refresh (debounced inside the strip)
+    if (overviewStrip.isVisible())
+    {
+        overviewStrip.setPlayheadPosition(audioProcessor.getPlaybackPosition());
+        overviewStrip.setRideSettings(audioProcessor.getRideSettings());
+        
+        if (audioProcessor.hasLoopRegion())
+            overviewStrip.setLoopRender(audioProcessor.getLoopRenderer().getLatestRender());
+    }
+    #endif
 }
 
 //==============================================================================
@@ -2178,9 +2322,178 @@ bool VocalRiderAudioProcessorEditor::keyPressed(const juce::KeyPress& key)
         return true;
     }
     
+    // Cmd+I = show/hide the dashboard of all magic.RIDE instances in the session
+    if (key.isKeyCode('I') && key.getModifiers().isCommandDown())
+    {
+        toggleInstanceDashboard();
+        return true;
+    }
+    
+    #if JucePlugin_Build_Standalone
+    // Space (Standalone only) = play/pause the loaded file
+    if (key == juce::KeyPress::spaceKey && audioProcessor.hasFileLoaded()
+        && audioProcessor.wrapperType == juce::AudioProcessor::wrapperType_Standalone)
+    {
+        audioProcessor.togglePlayback();
+        return true;
+    }
+    
+    // Cmd+R (Standalone only) = start/stop recording the processed output
+    if (key.isKeyCode('R') && key.getModifiers().isCommandDown()
+        && audioProcessor.wrapperType == juce::AudioProcessor::wrapperType_Standalone)
+    {
+        toggleRecording();
+        return true;
+    }
+    #endif
+    
     return false;  // Key not handled
 }
 
+void VocalRiderAudioProcessorEditor::toggleInstanceDashboard()
+{
+    if (instanceDashboard != nullptr)
+    {
+        instanceDashboard.reset();
+        return;
+    }
+    
+    instanceDashboard = std::make_unique<InstanceDashboard>(audioProcessor.getRegistrySlotIndex());
+    instanceDashboard->setBounds(getLocalBounds());
+    
+    // Deferred so the dashboard isn't deleted from inside its own button callback
+    juce::Component::SafePointer<VocalRiderAudioProcessorEditor> safeEditor(this);
+    instanceDashboard->onClose = [safeEditor]() {
+        juce::MessageManager::callAsync([safeEditor]() {
+            if (safeEditor != nullptr)
+                safeEditor->instanceDashboard.reset();
+        });
+    };
+    
+    addAndMakeVisible(*instanceDashboard);
+    instanceDashboard->grabKeyboardFocus();
+}
+
+#if JucePlugin_Build_Standalone
+void VocalRiderAudioProcessorEditor::toggleRecording()
+{
+    if (audioProcessor.isRecording())
+    {
+        const auto& recorder = audioProcessor.getRecorder();
+        auto seconds = static_cast<double>(recorder.getSamplesRecorded()) / recorder.getSampleRate();
+        audioProcessor.stopRecording();
+
+        juce::String text = "Saved " + recorder.getAudioFile().getFileName()
+                          + " (" + juce::String(seconds, 1) + " s)";
+        if (recorder.getSamplesDropped() > 0)
+            text << " - " << juce::String(recorder.getSamplesDropped()) << " samples dropped";
+
+        // Compact ".ride" sidecar for scripts and other tools
+        auto gainFile = recorder.getGainFile();
+        auto sidecar = recorder.getAudioFile().withFileExtension(GainCurveFormat::fileExtension);
+        auto presetName = presetComboBox.getText();
+        setStatusBarText(text + " - writing " + sidecar.getFileName() + "...");
+        
+        runFileJob([text, gainFile, sidecar, presetName]() mutable {
+            juce::String error;
+            if (GainCurveWriter::convertGainWav(gainFile, sidecar, presetName, error))
+                text << " + " << sidecar.getFileName();
+            else
+                text << " - " << error;
+            return text;
+        });
+        return;
+    }
+
+    juce::String baseName = audioProcessor.hasFileLoaded()
+        ? juce::File::createLegalFileName(audioProcessor.getLoadedFileName().upToLastOccurrenceOf(".", false, false))
+        : juce::String("magic.RIDE");
+    auto file = VocalRiderAudioProcessor::getRecordingsFolder()
+                    .getChildFile(baseName + " " + juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".wav")
+                    .getNonexistentSibling();
+
+    if (audioProcessor.startRecording(file))
+        setStatusBarText("Recording to " + file.getFileName() + " (Cmd+R to stop)");
+    else
+        setStatusBarText("Could not start recording");
+}
+
+void VocalRiderAudioProcessorEditor::runFileJob(std::function<juce::String()> job)
+{
+    if (fileJobPool == nullptr)
+        fileJobPool = std::make_unique<juce::ThreadPool>(1);
+    
+    juce::Component::SafePointer<VocalRiderAudioProcessorEditor> safeEditor(this);
+    fileJobPool->addJob([job = std::move(job), safeEditor]() {
+        auto result = job();
+        juce::MessageManager::callAsync([safeEditor, result]() {
+            if (safeEditor != nullptr)
+                safeEditor->setStatusBarText(result);
+        });
+    });
+}
+#endif
+
+bool VocalRiderAudioProcessorEditor::isInterestedInFileDrag(const juce::StringArray& files)
+{
+#if JucePlugin_Build_Standalone
+    if (audioProcessor.wrapperType != juce::AudioProcessor::wrapperType_Standalone)
+        return false;
+    
+    for (const auto& path : files)
+        if (audioProcessor.isSupportedAudioFile(juce::File(path))
+            || juce::File(path).hasFileExtension(GainCurveFormat::fileExtension))
+            return true;
+#else
+    juce::ignoreUnused(files);
+#endif
+    return false;
+}
+
+void VocalRiderAudioProcessorEditor::filesDropped(const juce::StringArray& files, int, int)
+{
+#if JucePlugin_Build_Standalone
+    for (const auto& path : files)
+    {
+        juce::File file(path);
+        
+        // Dropping a gain-curve sidecar exports it as CSV + JSON next to the original
+        if (file.hasFileExtension(GainCurveFormat::fileExtension))
+        {
+            setStatusBarText("Exporting " + file.getFileName() + "...");
+            runFileJob([file]() -> juce::String {
+                GainCurveReader reader(file);
+                if (reader.isValid()
+                    && reader.exportCsv(file.withFileExtension(".csv"))
+                    && reader.exportJson(file.withFileExtension(".json")))
+                    return "Exported " + file.getFileNameWithoutExtension() + ".csv / .json";
+                
+                return reader.isValid() ? "Could not export " + file.getFileName() : reader.getError();
+            });
+            return;
+        }
+        
+        if (!audioProcessor.isSupportedAudioFile(file))
+            continue;
+        
+        if (audioProcessor.loadAudioFile(file))
+        {
+            overviewStrip.loadFile(file, audioProcessor.getRideSettings());
+            overviewStrip.setVisible(true);
+            resized();
+            setStatusBarText("Loaded " + file.getFileName() + " (Space to play)");
+        }
+        else
+        {
+            setStatusBarText("Could not open " + file.getFileName());
+        }
+        return;
+    }
+#else
+    juce::ignoreUnused(files);
+#endif
+}
+
 void VocalRiderAudioProcessorEditor::mouseUp(const juce::MouseEvent& event)
 {
 #if MAGICRIDE_LITE
@@ -2243,6 +2556,46 @@ void VocalRiderAudioProcessorEditor::applyState(const ParameterState& state)
     noiseFloorSlider.setValue(state.noiseFloor, juce::sendNotification);
 }
 
+RideSettings VocalRiderAudioProcessorEditor::getRideSettingsFor(const ParameterState& state) const
+{
+    // Front-end settings (modes, look-ahead) aren't part of A/B and stay as they are
+    RideSettings settings = audioProcessor.getRideSettings();
+    settings.targetDb = state.target;
+    settings.boostRangeDb = state.boostRange;
+    settings.cutRangeDb = state.cutRange;
+    settings.speed = state.speed;
+    settings.attackMs = state.attack;
+    settings.releaseMs = state.release;
+    settings.holdMs = state.hold;
+    settings.breathReductionDb = state.breathReduction;
+    settings.transientPreservation = state.transientPreservation / 100.0f;
+    settings.noiseFloorDb = state.noiseFloor;
+    return settings;
+}
+
+void VocalRiderAudioProcessorEditor::showABCompareMenu()
+{
+    juce::PopupMenu menu;
+    menu.addItem(1, "Seamless A/B (shadow engine)", true, audioProcessor.isShadowEngineEnabled());
+    
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&abCompareButton),
+        [safeThis = juce::Component::SafePointer<VocalRiderAudioProcessorEditor>(this)](int result)
+        {
+            if (safeThis == nullptr || result != 1)
+                return;
+            
+            auto& processor = safeThis->audioProcessor;
+            const bool enable = !processor.isShadowEngineEnabled();
+            
+            // The shadow rides whichever state isn't showing
+            if (enable)
+                processor.setShadowSettings(safeThis->getRideSettingsFor(safeThis->isStateB ? safeThis->stateA
+                                                                                            : safeThis->stateB));
+            processor.setShadowEngineEnabled(enable);
+            safeThis->abCompareButton.setSeamless(enable);
+        });
+}
+
 void VocalRiderAudioProcessorEditor::saveStateForUndo()
 {
     // Trim redo history when adding new state
@@ -18,7 +18,10 @@
 #include "PluginProcessor.h"
 #include "UI/CustomLookAndFeel.h"
 #include "UI/WaveformDisplay.h"
+#include "UI/LayerRenderer.h"
 #include "UI/DualRangeKnob.h"
+#include "UI/OverviewStrip.h"
+#include "UI/InstanceDashboard.h"
 
 //==============================================================================
 // Animated Value Tooltip - appears below knobs with fade animation
@@ -388,7 +391,18 @@ public:
     
     void paint(juce::Graphics& g) override
     {
-        auto bounds = getLocalBounds().toFloat().reduced(2.0f);
+        // Track, inner circle, 0 dB tick and "dB" label are cached per size and
+        // device scale; only the fill arc and the number are drawn per update
+        const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (!cachedBackground.matches(getLocalBounds(), pixelScale))
+            cachedBackground = LayerRenderer::render(getLocalBounds(), pixelScale,
+                                                     [geometry = getArcGeometry()](juce::Graphics& lg) { paintBackground(lg, geometry); });
+        cachedBackground.draw(g, getLocalBounds());
+        
+        const auto geometry = getArcGeometry();
+        const auto arcBounds = geometry.arcBounds;
+        const float arcCenterY = geometry.centre.y;
+        const float arcThickness = geometry.thickness;
         
         // Calculate colors based on gain - smooth interpolation
         float normalizedGain = (rangeDb > 0.001f) ? juce::jlimit(-1.0f, 1.0f, currentGainDb / rangeDb) : 0.0f;
@@ -414,70 +428,6 @@ public:
             displayColour = neutralColour;
         }
         
-        // === CIRCULAR ARC INDICATOR (SPEEDOMETER - GAP AT BOTTOM) ===
-        // Using Path::addArc with explicit rectangle bounds for clarity
-        float arcRadius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.40f;
-        float arcCenterX = bounds.getCentreX();
-        float arcCenterY = bounds.getCentreY() + 2.0f;
-        float arcThickness = 3.5f;
-        
-        // Arc bounds (the ellipse that the arc sits on)
-        auto arcBounds = juce::Rectangle<float>(
-            arcCenterX - arcRadius, arcCenterY - arcRadius,
-            arcRadius * 2.0f, arcRadius * 2.0f
-        );
-        
-        // Path::addArc uses radians from 12 o'clock, CLOCKWISE positive
-        // For gap at bottom: start at 7:30 (225° from 12), end at 4:30 (-225° or 135° from 12)
-        // Actually, addArc: 0 = 12 o'clock (top), positive = clockwise
-        // 7:30 position = 225° clockwise from 12 = 225° = 5π/4
-        // 4:30 position = 135° clockwise from 12 = 135° = 3π/4
-        // We want arc from 7:30 to 4:30 going the LONG way (through top)
-        // That means: start at 5π/4 (225°), go COUNTER-clockwise to 3π/4 (135°)
-        // In addArc terms: start = 5π/4, end = 3π/4 - 2π = -5π/4
-        
-        // Actually let's think simpler:
-        // 0 rad = 12 o'clock (top)
-        // π/2 = 3 o'clock (right)
-        // π = 6 o'clock (bottom)
-        // 3π/2 = 9 o'clock (left)
-        // 
-        // Gap at bottom means we skip around π (6 o'clock)
-        // Arc goes from about 5π/4 (7:30) counter-clockwise to 3π/4 (4:30)
-        // That's: 5π/4 → 3π/2 → 0 → π/2 → 3π/4 (the long way, 270°)
-        
-        // Gap at bottom (around 180° / π): arc from 7:30 clockwise through top to 4:30
-        // 7:30 = 225° = 5π/4, 4:30 = 135° = 3π/4
-        // Go clockwise: 225° → 270° → 315° → 0° → 45° → 90° → 135° (through top)
-        float arcStart = juce::MathConstants<float>::pi * 1.25f;    // 5π/4 = 225° = 7:30
-        float arcEnd = juce::MathConstants<float>::pi * 2.75f;      // 11π/4 = 495° = 4:30 (going clockwise)
-        
-        // Draw background arc (dim track) - use butt caps for clean straight edges
-        juce::Path bgArc;
-        bgArc.addArc(arcBounds.getX(), arcBounds.getY(), 
-                     arcBounds.getWidth(), arcBounds.getHeight(),
-                     arcStart, arcEnd, true);
-        g.setColour(CustomLookAndFeel::getSurfaceColour().darker(0.15f));
-        g.strokePath(bgArc, juce::PathStrokeType(arcThickness, juce::PathStrokeType::curved,
-                                                  juce::PathStrokeType::butt));
-        
-        // Draw semi-transparent circle inside the arc for better readability
-        float innerCircleRadius = arcRadius - arcThickness - 3.0f;
-        g.setColour(juce::Colours::black.withAlpha(0.4f));
-        g.fillEllipse(arcCenterX - innerCircleRadius, arcCenterY - innerCircleRadius,
-                      innerCircleRadius * 2.0f, innerCircleRadius * 2.0f);
-        
-        // Draw center tick mark (0 dB = TOP = 0 radians in addArc convention)
-        float centerTickAngle = 0.0f;  // 0 = top in addArc
-        // Convert to x,y: in addArc, 0 = top means we need to go UP from center
-        float tickInnerR = arcRadius - 5.0f;
-        float tickOuterR = arcRadius + 5.0f;
-        g.setColour(CustomLookAndFeel::getDimTextColour().withAlpha(0.6f));
-        // For addArc convention: x = center + r*sin(angle), y = center - r*cos(angle)
-        g.drawLine(arcCenterX, arcCenterY - tickInnerR,
-                   arcCenterX, arcCenterY - tickOuterR,
-                   1.5f);
-        
         // Draw filled arc portion based on gain
         if (std::abs(normalizedGain) > 0.01f)
         {
@@ -529,22 +479,103 @@ public:
         g.setColour(displayColour);
         
         auto textBounds = juce::Rectangle<float>(
-            bounds.getX(), arcCenterY - 7.0f,
-            bounds.getWidth(), 14.0f
+            geometry.bounds.getX(), arcCenterY - 7.0f,
+            geometry.bounds.getWidth(), 14.0f
         );
         g.drawText(gainText, textBounds.toNearestInt(), juce::Justification::centred);
+    }
+    
+private:
+    /** Arc layout shared by the cached background and the per-update fill */
+    struct ArcGeometry
+    {
+        juce::Rectangle<float> bounds;
+        juce::Rectangle<float> arcBounds;   // The ellipse the arc sits on
+        juce::Point<float> centre;
+        float radius = 0.0f;
+        float thickness = 3.5f;
+    };
+    
+    ArcGeometry getArcGeometry() const
+    {
+        ArcGeometry geometry;
+        geometry.bounds = getLocalBounds().toFloat().reduced(2.0f);
+        geometry.radius = juce::jmin(geometry.bounds.getWidth(), geometry.bounds.getHeight()) * 0.40f;
+        geometry.centre = { geometry.bounds.getCentreX(), geometry.bounds.getCentreY() + 2.0f };
+        geometry.arcBounds = juce::Rectangle<float>(geometry.centre.x - geometry.radius, geometry.centre.y - geometry.radius,
+                                                    geometry.radius * 2.0f, geometry.radius * 2.0f);
+        return geometry;
+    }
+    
+    static void paintBackground(juce::Graphics& g, const ArcGeometry& geometry)
+    {
+        const auto arcBounds = geometry.arcBounds;
+        const float arcRadius = geometry.radius;
+        const float arcCenterX = geometry.centre.x;
+        const float arcCenterY = geometry.centre.y;
+        const float arcThickness = geometry.thickness;
+        
+        // Path::addArc uses radians from 12 o'clock, CLOCKWISE positive
+        // For gap at bottom: start at 7:30 (225° from 12), end at 4:30 (-225° or 135° from 12)
+        // Actually, addArc: 0 = 12 o'clock (top), positive = clockwise
+        // 7:30 position = 225° clockwise from 12 = 225° = 5π/4
+        // 4:30 position = 135° clockwise from 12 = 135° = 3π/4
+        // We want arc from 7:30 to 4:30 going the LONG way (through top)
+        // That means: start at 5π/4 (225°), go COUNTER-clockwise to 3π/4 (135°)
+        // In addArc terms: start = 5π/4, end = 3π/4 - 2π = -5π/4
+        
+        // Actually let's think simpler:
+        // 0 rad = 12 o'clock (top)
+        // π/2 = 3 o'clock (right)
+        // π = 6 o'clock (bottom)
+        // 3π/2 = 9 o'clock (left)
+        // 
+        // Gap at bottom means we skip around π (6 o'clock)
+        // Arc goes from about 5π/4 (7:30) counter-clockwise to 3π/4 (4:30)
+        // That's: 5π/4 → 3π/2 → 0 → π/2 → 3π/4 (the long way, 270°)
+        
+        // Gap at bottom (around 180° / π): arc from 7:30 clockwise through top to 4:30
+        // 7:30 = 225° = 5π/4, 4:30 = 135° = 3π/4
+        // Go clockwise: 225° → 270° → 315° → 0° → 45° → 90° → 135° (through top)
+        float arcStart = juce::MathConstants<float>::pi * 1.25f;    // 5π/4 = 225° = 7:30
+        float arcEnd = juce::MathConstants<float>::pi * 2.75f;      // 11π/4 = 495° = 4:30 (going clockwise)
+        
+        // Draw background arc (dim track) - use butt caps for clean straight edges
+        juce::Path bgArc;
+        bgArc.addArc(arcBounds.getX(), arcBounds.getY(), 
+                     arcBounds.getWidth(), arcBounds.getHeight(),
+                     arcStart, arcEnd, true);
+        g.setColour(CustomLookAndFeel::getSurfaceColour().darker(0.15f));
+        g.strokePath(bgArc, juce::PathStrokeType(arcThickness, juce::PathStrokeType::curved,
+                                                  juce::PathStrokeType::butt));
+        
+        // Draw semi-transparent circle inside the arc for better readability
+        float innerCircleRadius = arcRadius - arcThickness - 3.0f;
+        g.setColour(juce::Colours::black.withAlpha(0.4f));
+        g.fillEllipse(arcCenterX - innerCircleRadius, arcCenterY - innerCircleRadius,
+                      innerCircleRadius * 2.0f, innerCircleRadius * 2.0f);
+        
+        // Draw center tick mark (0 dB = TOP = 0 radians in addArc convention)
+        // Convert to x,y: in addArc, 0 = top means we need to go UP from center
+        float tickInnerR = arcRadius - 5.0f;
+        float tickOuterR = arcRadius + 5.0f;
+        g.setColour(CustomLookAndFeel::getDimTextColour().withAlpha(0.6f));
+        // For addArc convention: x = center + r*sin(angle), y = center - r*cos(angle)
+        g.drawLine(arcCenterX, arcCenterY - tickInnerR,
+                   arcCenterX, arcCenterY - tickOuterR,
+                   1.5f);
         
         // Small "dB" label below
         g.setFont(CustomLookAndFeel::getPluginFont(7.0f, false));
         g.setColour(CustomLookAndFeel::getDimTextColour().withAlpha(0.5f));
         auto dbBounds = juce::Rectangle<float>(
-            bounds.getX(), arcCenterY + 5.0f,
-            bounds.getWidth(), 10.0f
+            geometry.bounds.getX(), arcCenterY + 5.0f,
+            geometry.bounds.getWidth(), 10.0f
         );
         g.drawText("dB", dbBounds.toNearestInt(), juce::Justification::centred);
     }
     
-private:
+    CachedLayer cachedBackground;
     float currentGainDb = 0.0f;
     float rangeDb = 12.0f;
 };
@@ -1112,6 +1143,35 @@ class ABCompareButton : public juce::Button
 public:
     ABCompareButton() : juce::Button("A/B") { setClickingTogglesState(true); }
     
+    // Right-click opens the A/B options instead of toggling
+    std::function<void()> onRightClick;
+    
+    void setSeamless(bool shouldBeSeamless)
+    {
+        if (seamless != shouldBeSeamless)
+        {
+            seamless = shouldBeSeamless;
+            repaint();
+        }
+    }
+    
+    void mouseDown(const juce::MouseEvent& e) override
+    {
+        if (e.mods.isPopupMenu())
+        {
+            if (onRightClick)
+                onRightClick();
+            return;
+        }
+        juce::Button::mouseDown(e);
+    }
+    
+    void mouseUp(const juce::MouseEvent& e) override
+    {
+        if (!e.mods.isPopupMenu())
+            juce::Button::mouseUp(e);
+    }
+    
     void paintButton(juce::Graphics& g, bool shouldDrawButtonAsHighlighted, bool /*shouldDrawButtonAsDown*/) override
     {
         auto bounds = getLocalBounds().toFloat().reduced(2.0f);
@@ -1137,7 +1197,18 @@ public:
         
         g.setColour(isB ? CustomLookAndFeel::getAccentColour() : CustomLookAndFeel::getDimTextColour());
         g.drawText("B", rightHalf, juce::Justification::centred);
+        
+        // Seamless (shadow engine) indicator
+        if (seamless)
+        {
+            auto full = getLocalBounds().toFloat().reduced(2.0f);
+            g.setColour(CustomLookAndFeel::getAccentColour());
+            g.fillEllipse(full.getRight() - 5.0f, full.getY() + 2.0f, 3.0f, 3.0f);
+        }
     }
+    
+private:
+    bool seamless = false;
 };
 
 //==============================================================================
@@ -1857,6 +1928,7 @@ private:
 
 //==============================================================================
 class VocalRiderAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                        public juce::FileDragAndDropTarget,
                                         public juce::Timer
 {
 public:
@@ -1869,6 +1941,10 @@ public:
     bool keyPressed(const juce::KeyPress& key) override;
     void mouseUp(const juce::MouseEvent& event) override;
     
+    // Audio file drop (Standalone player only)
+    bool isInterestedInFileDrag(const juce::StringArray& files) override;
+    void filesDropped(const juce::StringArray& files, int x, int y) override;
+    
 
 private:
     // Window size presets (FabFilter-style)
@@ -1924,6 +2000,12 @@ private:
     //==============================================================================
     // Main waveform display (fills most of the window)
     WaveformDisplay waveformDisplay;
+    
+    #if JucePlugin_Build_Standalone
+    // Whole-file overview of the loaded file (Standalone player, hidden until a file is dropped)
+    OverviewStrip overviewStrip;
+    static constexpr int overviewStripHeight = 36;
+    #endif
 
     //==============================================================================
     // Bottom control panel (tab overlay)
@@ -1973,6 +2055,9 @@ private:
     // Phrase indicator silence counter (UI-level timeout for natural mode indicator)
     int phraseIndicatorSilenceCount = 0;
     
+    // Last what-if ride preview applied to the waveform display
+    int lastRidePreviewSequence = 0;
+    
     // A/B Compare state storage
     struct ParameterState {
         float target = -18.0f;
@@ -2000,6 +2085,22 @@ private:
     void performRedo();
     ParameterState getCurrentState();
     void applyState(const ParameterState& state);
+    RideSettings getRideSettingsFor(const ParameterState& state) const;
+    void showABCompareMenu();
+    
+    #if JucePlugin_Build_Standalone
+    // Standalone output recording (Cmd+R)
+    void toggleRecording();
+    
+    // Sidecar conversion and CSV/JSON export read and write whole takes, so they
+    // run on a worker; the job's returned text is shown in the status bar
+    void runFileJob(std::function<juce::String()> job);
+    std::unique_ptr<juce::ThreadPool> fileJobPool;  // Created on first use
+    #endif
+    
+    // Session-wide instance dashboard (Cmd+I)
+    std::unique_ptr<InstanceDashboard> instanceDashboard;
+    void toggleInstanceDashboard();
     
     // Help descriptions for each control
     juce::String getHelpText(const juce::String& controlName);
@@ -2026,8 +2127,23 @@ private:
     // Displayed gain (decays to zero when no audio)
     float displayedGainDb = 0.0f;
     
-    // Cached noise texture (regenerated only on resize, not every paint)
-    juce::Image cachedNoiseTexture;
+    // Cached static chrome: background, noise, header, brand tab, separators,
+    // vignettes and bottom bar. Rendered once per size and device scale; after
+    // a resize it is re-rendered in the background and the previous image is
+    // stretched over the window until it lands.
+    struct ChromeLayout
+    {
+        juce::Rectangle<int> bounds;
+        juce::Rectangle<int> bottomBarBounds;
+        juce::Rectangle<int> upgradeStripBounds;    // Lite only
+    };
+    ChromeLayout getChromeLayout() const;
+    static void paintChrome(juce::Graphics& g, const ChromeLayout& layout);
+    
+    CachedLayer cachedChrome;
+    bool chromeNeedsRedraw = true;
+    LayerRenderer chromeRenderer { "magic.RIDE Editor Chrome" };
+    static constexpr int chromeLayer = 0;
     
     // Parameter attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> targetAttachment;
@@ -2099,19 +2215,31 @@ private:
             float trackY = drawArea.getY() + trackPadding;
             float trackHeight = drawArea.getHeight() - trackPadding * 2.0f;
             auto trackBounds = juce::Rectangle<float>(trackX, trackY, trackWidth, trackHeight);
-            
-            // === TRACK BACKGROUND (dark recessed groove) ===
-            g.setColour(juce::Colour(0xFF0F1114));  // Very dark
-            g.fillRoundedRectangle(trackBounds, trackWidth / 2.0f);
-            
-            // Subtle inset shadow
-            g.setColour(juce::Colour(0x30000000));
-            g.drawRoundedRectangle(trackBounds, trackWidth / 2.0f, 1.0f);
-            
-            // === CENTER TICK (0 dB reference) ===
             float centerY = trackBounds.getCentreY();
-            g.setColour(juce::Colour(0xFF4A4F58));
-            g.fillRect(trackX - 2.0f, centerY - 0.5f, trackWidth + 4.0f, 1.0f);
+            
+            // Groove and 0 dB tick only change with size, so they are cached at
+            // device resolution; the fill and handle follow the value
+            const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+            if (!cachedTrack.matches(getLocalBounds(), pixelScale))
+            {
+                cachedTrack = LayerRenderer::render(getLocalBounds(), pixelScale, [trackBounds](juce::Graphics& lg)
+                {
+                    const float width = trackBounds.getWidth();
+                    
+                    // === TRACK BACKGROUND (dark recessed groove) ===
+                    lg.setColour(juce::Colour(0xFF0F1114));  // Very dark
+                    lg.fillRoundedRectangle(trackBounds, width / 2.0f);
+                    
+                    // Subtle inset shadow
+                    lg.setColour(juce::Colour(0x30000000));
+                    lg.drawRoundedRectangle(trackBounds, width / 2.0f, 1.0f);
+                    
+                    // === CENTER TICK (0 dB reference) ===
+                    lg.setColour(juce::Colour(0xFF4A4F58));
+                    lg.fillRect(trackBounds.getX() - 2.0f, trackBounds.getCentreY() - 0.5f, width + 4.0f, 1.0f);
+                });
+            }
+            cachedTrack.draw(g, getLocalBounds());
             
             // === HANDLE POSITION ===
             float normalizedValue = currentValueDb / 12.0f;  // -1 to +1
@@ -2277,6 +2405,7 @@ private:
         }
         
     private:
+        CachedLayer cachedTrack;
         float currentValueDb = 0.0f;
         bool isDragging = false;
     };
@@ -2300,13 +2429,18 @@ private:
     WindowSize currentWindowSize = WindowSize::Medium;
     float uiScaleFactor = 1.0f;
     
-    // Fixed window dimensions for each preset
+    // Window dimensions for each preset (the window can also be dragged to
+    // any size between the resize limits)
     static constexpr int smallWidth = 550;
     static constexpr int smallHeight = 380;
     static constexpr int mediumWidth = 700;
     static constexpr int mediumHeight = 480;
     static constexpr int largeWidth = 900;
     static constexpr int largeHeight = 600;
+    static constexpr int maxWidth = 1800;
+    static constexpr int maxHeight = 1200;
+    
+    void updateResizeLimits();
     
     static constexpr int controlPanelHeight = 130;  // Extra room for even larger knobs
 
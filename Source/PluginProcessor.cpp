@@ -106,6 +106,8 @@ VocalRiderAudioProcessor::VocalRiderAudioProcessor()
     formatManager.registerBasicFormats();
     #endif
     
+    registrySlot = InstanceRegistry::getInstance().acquire();
+    
     startTimerHz(30);
 }
 
@@ -114,13 +116,30 @@ VocalRiderAudioProcessor::~VocalRiderAudioProcessor()
     stopTimer();
     
     #if JucePlugin_Build_Standalone
+    recorder.stop();
     transportSource.setSource(nullptr);
     #endif
+    
+    InstanceRegistry::getInstance().release(registrySlot);
 }
 
 //==============================================================================
 void VocalRiderAudioProcessor::timerCallback()
 {
+    #if JucePlugin_Build_Standalone
+    // Loop region: queue a re-render when settings change, free retired renders
+    if (loopRenderer.hasRegion())
+        loopRenderer.setRideSettings(getRideSettings());
+    loopRenderer.collectGarbage();
+    #endif
+    
+    // Dashboard: values that only change from the message thread
+    if (registrySlot != nullptr)
+    {
+        registrySlot->setLatencySamples(getLatencySamples());
+        registrySlot->setModeFlags(getRegistryModeFlags());
+    }
+    
     // Relay gain output to host from the message thread.
     // In VST3, beginEdit/performEdit/endEdit only work from the message thread.
     // The audio thread path (outputParameterChanges) is treated as display-only
@@ -333,6 +352,23 @@ double VocalRiderAudioProcessor::getTailLengthSeconds() const
     return isLookAheadEnabled() ? (static_cast<double>(lookAheadSamples.load()) / currentSampleRate) : 0.0;
 }
 
+void VocalRiderAudioProcessor::updateTrackProperties(const TrackProperties& properties)
+{
+    if (registrySlot != nullptr)
+        registrySlot->setName(properties.name.value_or(juce::String()));
+}
+
+juce::uint32 VocalRiderAudioProcessor::getRegistryModeFlags() const
+{
+    juce::uint32 flags = 0;
+    if (naturalModeEnabled.load())  flags |= InstanceRegistry::naturalMode;
+    if (useLufsMode.load())         flags |= InstanceRegistry::lufsMode;
+    if (isLookAheadEnabled())       flags |= InstanceRegistry::lookAhead;
+    if (shadowEngineEnabled.load()) flags |= InstanceRegistry::shadowEngine;
+    if (sidechainEnabled.load())    flags |= InstanceRegistry::sidechain;
+    return flags;
+}
+
 void VocalRiderAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& buffer,
                                                       juce::MidiBuffer& midiMessages)
 {
@@ -361,31 +397,20 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
 {
     currentSampleRate = sampleRate;
 
+    // Detection front-end and ride stage (detector sized for the 2x block headroom below)
     float speed = speedParam->load();
-    float windowMs = juce::jmap(speed, 0.0f, 100.0f, 100.0f, 10.0f);
-    rmsDetector.prepare(sampleRate, windowMs);
+    rideDetector.prepare(sampleRate, samplesPerBlock * 2, speed);
+    rideHistory.prepare(sampleRate, RidePreviewRenderer::previewSeconds + RidePreviewRenderer::warmUpSeconds);
+    for (auto& core : rideCores)
+        core.prepare(sampleRate);
+    shadowCrossfadeLength = static_cast<int>(shadowCrossfadeSeconds * sampleRate);
+    shadowCrossfadeRemaining = 0;
     
-    gainSmoother.prepare(sampleRate);
-    peakDetector.prepare(sampleRate);
-    peakDetector.setAttackTime(0.1f);
-    peakDetector.setReleaseTime(50.0f);
-    
-    // Sidechain bandpass for vocal spectral focus (200Hz - 4kHz)
     juce::dsp::ProcessSpec spec;
     spec.sampleRate = sampleRate;
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = 1;
     
-    sidechainHPF.prepare(spec);
-    sidechainHPF.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    sidechainHPF.setCutoffFrequency(200.0f);  // Focus on vocal fundamentals and up
-    sidechainHPF.setResonance(0.707f);
-    
-    sidechainLPF.prepare(spec);
-    sidechainLPF.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-    sidechainLPF.setCutoffFrequency(4000.0f);  // Cut high-frequency sibilance/noise
-    sidechainLPF.setResonance(0.707f);
-    
     // Transient detection filter (fast HPF for detecting sharp attacks)
     transientHPF.prepare(spec);
     transientHPF.setType(juce::dsp::StateVariableTPTFilterType::highpass);
@@ -394,30 +419,6 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     transientEnvelope = 0.0f;
     sustainEnvelope = 0.0f;
     
-    // LUFS K-weighting filters
-    lufsPreFilter.prepare(spec);
-    lufsPreFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    lufsPreFilter.setCutoffFrequency(38.0f);  // High-pass for K-weighting
-    lufsPreFilter.setResonance(0.5f);
-    
-    lufsHighShelf.prepare(spec);
-    lufsHighShelf.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    lufsHighShelf.setCutoffFrequency(1500.0f);  // Approximate high shelf boost
-    lufsHighShelf.setResonance(0.707f);
-    
-    lufsIntegrator = 0.0f;
-    
-    // Vocal focus filters (frequency-weighted detection for better vocal tracking)
-    vocalFocusHighPass.prepare(spec);
-    vocalFocusHighPass.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    vocalFocusHighPass.setCutoffFrequency(180.0f);  // Cut low rumble below vocal range
-    vocalFocusHighPass.setResonance(0.707f);
-    
-    vocalFocusLowPass.prepare(spec);
-    vocalFocusLowPass.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-    vocalFocusLowPass.setCutoffFrequency(5000.0f);  // Cut high frequencies above vocal presence
-    vocalFocusLowPass.setResonance(0.707f);
-    
     vocalFocusBandBoost.prepare(spec);
     vocalFocusBandBoost.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
     vocalFocusBandBoost.setCutoffFrequency(2500.0f);  // Boost vocal presence region
@@ -426,15 +427,6 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     // Sidechain RMS detector
     sidechainRmsDetector.prepare(sampleRate);
     sidechainRmsDetector.setWindowSize(0.05f);  // 50ms window for sidechain
-    lufsSampleCount = 0;
-    
-    // Breath detection state
-    isBreath = false;
-    breathEnvelope = 0.0f;
-    
-    // Reset noise gate state
-    gateOpen = false;
-    gateSmoothedLevel = -100.0f;
     
     // Do NOT call updateAttackReleaseFromSpeed here - let processBlock use the
     // restored/saved values for attack/release/hold from APVTS. Only update from
@@ -442,17 +434,14 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     
     // Compute sample-rate-independent parameter smoothing (~3ms time constant)
     paramSmoothingCoeff = std::exp(-1.0f / (0.003f * static_cast<float>(sampleRate)));
-    
-    lastSpeed = speed;
 
     // Pre-allocate scratch buffers for processBlock (avoid heap allocs on audio thread)
     preparedBlockSize = samplesPerBlock * 2;  // 2x headroom for hosts that exceed samplesPerBlock
     scratchMonoBuffer.setSize(1, preparedBlockSize, false, true);  // clearExtraSpace=true
-    scratchFilteredBuffer.setSize(1, preparedBlockSize, false, true);
     scratchSidechainBuffer.setSize(1, preparedBlockSize, false, true);
     scratchInputSamples.assign(static_cast<size_t>(preparedBlockSize), 0.0f);
     scratchGainSamples.assign(static_cast<size_t>(preparedBlockSize), 0.0f);
-    scratchPeakAheadLevels.assign(static_cast<size_t>(preparedBlockSize), -100.0f);
+    scratchShadowGainSamples.assign(static_cast<size_t>(preparedBlockSize), 0.0f);
     scratchPrecomputedGains.assign(static_cast<size_t>(preparedBlockSize), 1.0f);  // 1.0 = unity gain
     scratchOutputSamples.assign(static_cast<size_t>(preparedBlockSize), 0.0f);
 
@@ -465,19 +454,8 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     lookAheadWritePos = 0;
     lookAheadBufferFilled = false;
 
-    // Phrase detection parameters
-    phraseMinSamples = static_cast<int>(0.1 * sampleRate);
-    silenceMinSamples = static_cast<int>(0.15 * sampleRate);
+    // Phrase state is reset by RideCore::prepare()
     inPhrase.store(false);
-    phraseAccumulator = 0.0f;
-    phraseSampleCount = 0;
-    currentPhraseGainDb = 0.0f;
-    phraseLastLevelDb = -100.0f;
-    phraseStartSample = 0;
-    phraseEndSample = 0;
-    lastPhraseGainDb = 0.0f;
-    silenceSampleCount = 0;
-    phraseGainSmoother = 0.0f;
     
     // Phrase lookahead buffer (500ms for phrase pre-analysis)
     phraseLookaheadSamples = static_cast<int>(0.5 * sampleRate);
@@ -494,14 +472,16 @@ void VocalRiderAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     #if JucePlugin_Build_Standalone
     currentBlockSize = samplesPerBlock;
     transportSource.prepareToPlay(samplesPerBlock, sampleRate);
+    loopRenderer.prepare(sampleRate);
+    scratchLoopGainDb.assign(static_cast<size_t>(preparedBlockSize), 0.0f);
     #endif
 }
 
 void VocalRiderAudioProcessor::releaseResources()
 {
-    rmsDetector.reset();
-    gainSmoother.reset();
-    peakDetector.reset();
+    rideDetector.reset();
+    for (auto& core : rideCores)
+        core.reset();
     lookAheadDelayBuffer.clear();
     lookAheadBufferFilled = false;
 
@@ -550,6 +530,7 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 {
     juce::ignoreUnused(midiMessages);
     juce::ScopedNoDenormals noDenormals;
+    const auto blockStartTicks = juce::Time::getHighResolutionTicks();
 
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -566,23 +547,31 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, numSamples);
 
+    // Set when playback comes from a loop render, which carries its own gain curve
+    bool useRenderedGain = false;
+
     #if JucePlugin_Build_Standalone
     if (fileLoaded.load() && transportPlaying.load())
     {
-        juce::AudioSourceChannelInfo info(&buffer, 0, numSamples);
-        transportSource.getNextAudioBlock(info);
+        auto loopResult = LoopRenderer::BlockResult::notReady;
+        if (loopRenderer.hasRegion() && numSamples <= preparedBlockSize)
+            loopResult = loopRenderer.readNextBlock(buffer, juce::jmin(2, totalNumOutputChannels),
+                                                    scratchLoopGainDb.data(), numSamples);
+
+        if (loopResult == LoopRenderer::BlockResult::notReady)
+        {
+            juce::AudioSourceChannelInfo info(&buffer, 0, numSamples);
+            transportSource.getNextAudioBlock(info);
+        }
+
+        useRenderedGain = (loopResult == LoopRenderer::BlockResult::audioAndGain);
     }
     #endif
 
-    // Safe sample rate (fallback to 44100 if host hasn't called prepareToPlay yet)
-    const double safeSampleRate = getSampleRate() > 0.0 ? getSampleRate() : 44100.0;
-    
     // Get parameters with smoothing to prevent clicks/pops on rapid changes
     float targetLevelRaw = targetLevelParam->load();
-    float speed = speedParam->load();
     float boostRangeRaw = boostRangeParam->load();
     float cutRangeRaw = cutRangeParam->load();
-    bool useLookAhead = isLookAheadEnabled();
     
     // Smooth target and range parameters (prevents clicks on rapid UI changes)
     smoothedTargetLevel = smoothedTargetLevel * paramSmoothingCoeff + targetLevelRaw * (1.0f - paramSmoothingCoeff);
@@ -592,16 +581,6 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     float boostRange = smoothedBoostRange;
     float cutRange = smoothedCutRange;
 
-    // Update speed-dependent RMS window (always keep in sync)
-    if (std::abs(speed - lastSpeed) > 0.5f)
-    {
-        float windowMs = juce::jmap(speed, 0.0f, 100.0f, 100.0f, 10.0f);
-        rmsDetector.setWindowSize(windowMs);
-        lastSpeed = speed;
-        // Note: attack/release are NOT overwritten here — they're driven by
-        // the APVTS parameters below, which persist independently of speed.
-    }
-
     // Sync advanced parameters from APVTS (source of truth for persistence)
     if (attackParam != nullptr) attackMs.store(attackParam->load());
     if (releaseParam != nullptr) releaseMs.store(releaseParam->load());
@@ -613,16 +592,6 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     if (outputTrimParam != nullptr) outputTrimDb.store(outputTrimParam->load());
     if (noiseFloorParam != nullptr) noiseFloorDb.store(noiseFloorParam->load());
 
-    // Apply advanced attack/release/hold (only update when changed to avoid needless exp() calls)
-    {
-        float atk = attackMs.load();
-        float rel = releaseMs.load();
-        float hld = holdMs.load();
-        if (std::abs(atk - lastAttackMs) > 0.01f) { gainSmoother.setAttackTime(atk); lastAttackMs = atk; }
-        if (std::abs(rel - lastReleaseMs) > 0.01f) { gainSmoother.setReleaseTime(rel); lastReleaseMs = rel; }
-        if (std::abs(hld - lastHoldMs) > 0.01f) { gainSmoother.setHoldTime(hld); lastHoldMs = hld; }
-    }
-
     // Quick silent-buffer check: if the entire buffer is silent and natural mode is on,
     // ensure phrase state is cleared (handles DAW stop where blocks become silence)
     if (naturalModeEnabled.load())
@@ -643,8 +612,8 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
             if (processorSilenceBlockCount > 10)  // ~10 blocks of pure silence (~100ms)
             {
                 inPhrase.store(false);
-                phraseGainSmoother = 0.0f;
-                currentPhraseGainDb = 0.0f;
+                for (auto& core : rideCores)
+                    core.clearPhraseGain();
             }
         }
         else
@@ -723,62 +692,25 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         sidechainLevelDb.store(-100.0f);
     }
 
-    // === VOCAL FOCUS FILTER (frequency-weighted detection) ===
-    // Create filtered copy for detection (isolates vocal fundamentals, pre-allocated)
-    auto& filteredBuffer = scratchFilteredBuffer;
-    filteredBuffer.copyFrom(0, 0, monoBuffer, 0, 0, numSamples);
-    
-    bool useVocalFocus = vocalFocusEnabled.load();
-    
-    // Use SubBlock to ensure filter only processes valid numSamples (not entire pre-allocated buffer)
-    {
-        auto filteredBlockSub = juce::dsp::AudioBlock<float>(filteredBuffer)
-                                    .getSubBlock(0, static_cast<size_t>(numSamples));
-        juce::dsp::ProcessContextReplacing<float> filterContext(filteredBlockSub);
-        
-        if (useVocalFocus)
-        {
-            vocalFocusHighPass.process(filterContext);  // Cut below 180Hz
-            vocalFocusLowPass.process(filterContext);   // Cut above 5kHz
-        }
-        else
-        {
-            sidechainHPF.process(filterContext);  // High-pass at 200Hz
-            sidechainLPF.process(filterContext);  // Low-pass at 4kHz
-        }
-    }
-    
-    const float* filteredRead = filteredBuffer.getReadPointer(0);
-    
-    // === LUFS CALCULATION (if enabled) ===
-    bool useLufs = useLufsMode.load();
-    float measuredLufs = -100.0f;
-    if (lufsNeedsReset.exchange(false))
-    {
-        lufsIntegrator = 0.0f;
-        lufsSampleCount = 0;
-    }
-    if (useLufs)
-    {
-        measuredLufs = calculateLufs(monoRead, numSamples);
-        inputLufs.store(measuredLufs);
-    }
-    
-    // === BREATH DETECTION ===
-    float breathReduce = breathReductionDb.load();
-    bool doBreathDetection = breathReduce > 0.0f;
-    float spectralFlat = 0.0f;
-    float zeroCross = 0.0f;
-    if (doBreathDetection)
+    // === SIDECHAIN TARGET ADJUSTMENT ===
+    // When sidechain is enabled, dynamic target = sidechain RMS + offset
+    float effectiveTarget = targetLevel;
+    const bool sidechainDrivesTarget = useSidechain && sidechainLevel > -60.0f;
+    if (sidechainDrivesTarget)
     {
-        spectralFlat = calculateSpectralFlatness(monoRead, numSamples);
-        zeroCross = calculateZeroCrossingRate(monoRead, numSamples);
-        isBreath = detectBreath(spectralFlat, zeroCross);
+        float offsetDb = sidechainAmount.load();
+        effectiveTarget = sidechainLevel + offsetDb;
+        effectiveTarget = juce::jlimit(-50.0f, 0.0f, effectiveTarget);
     }
+    effectiveTargetDb.store(effectiveTarget);
+    targetLevel = effectiveTarget;
     
-    // === TRANSIENT PRESERVATION ===
-    float transientPres = transientPreservation.load();
-    bool doTransientPreservation = transientPres > 0.0f;
+    // Per-block settings snapshot for the detector and ride stages
+    RideSettings rideSettings = getRideSettings();
+    rideSettings.targetDb = targetLevel;
+    rideSettings.boostRangeDb = boostRange;
+    rideSettings.cutRangeDb = cutRange;
+    const bool useLookAhead = rideSettings.useLookAhead;
     
     // === AUTOMATION MODE ===
     AutomationMode autoMode = automationMode.load();
@@ -826,350 +758,135 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         }
     }
 
-    // === PREDICTIVE LOOK-AHEAD: Pre-scan for peaks (pre-allocated) ===
-    auto& peakAheadLevels = scratchPeakAheadLevels;
-    std::fill(peakAheadLevels.begin(), peakAheadLevels.begin() + numSamples, -100.0f);
-    if (useLookAhead)
-    {
-        int scanWindow = juce::jmin(lookAheadSamples.load(), numSamples);
-        // O(n) sliding window maximum using backward pass
-        // Step 1: Forward pass to find max from each sample to end of its window
-        float runningMax = 0.0f;
-        for (int sample = numSamples - 1; sample >= 0; --sample)
-        {
-            // Reset running max at window boundaries
-            if ((numSamples - 1 - sample) % scanWindow == 0)
-                runningMax = 0.0f;
-            runningMax = juce::jmax(runningMax, std::abs(filteredRead[sample]));
-            peakAheadLevels[static_cast<size_t>(sample)] = runningMax;
-        }
-        // Step 2: Second pass to merge block boundaries (complete sliding window max)
-        // and convert to dB
-        float suffixMax = 0.0f;
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            int blockEnd = sample + scanWindow;
-            if (blockEnd <= numSamples)
-            {
-                // Approximate: use the forward-pass max (covers most of the window)
-                float peakVal = peakAheadLevels[static_cast<size_t>(sample)];
-                peakAheadLevels[static_cast<size_t>(sample)] = 
-                    juce::Decibels::gainToDecibels(peakVal, -100.0f);
-            }
-            else
-            {
-                float peakVal = peakAheadLevels[static_cast<size_t>(sample)];
-                peakAheadLevels[static_cast<size_t>(sample)] = 
-                    juce::Decibels::gainToDecibels(peakVal, -100.0f);
-            }
-        }
-    }
-
-    // Pre-compute gain values (pre-allocated, unity-initialized for safety)
-    auto& precomputedGains = scratchPrecomputedGains;
-    std::fill(precomputedGains.begin(), precomputedGains.begin() + numSamples, 1.0f);
-    
-    // Gate smoothing coefficient (fast attack, slower release)
-    const float gateSmoothAttack = 0.99f;
-    const float gateSmoothRelease = 0.9995f;
-    
-    // === SIDECHAIN TARGET ADJUSTMENT ===
-    // When sidechain is enabled, dynamic target = sidechain RMS + offset
-    float effectiveTarget = targetLevel;
-    if (useSidechain && sidechainLevel > -60.0f)
-    {
-        float offsetDb = sidechainAmount.load();
-        effectiveTarget = sidechainLevel + offsetDb;
-        effectiveTarget = juce::jlimit(-50.0f, 0.0f, effectiveTarget);
-    }
-    effectiveTargetDb.store(effectiveTarget);
-    targetLevel = effectiveTarget;
-    
-    // Check if Natural (phrase-based) mode is enabled
-    bool useNaturalMode = naturalModeEnabled.load();
-    
     // Handle thread-safe phrase state reset (triggered by UI toggle)
     if (phraseStateNeedsReset.exchange(false))
     {
         inPhrase.store(false);
-        phraseAccumulator = 0.0f;
-        phraseSampleCount = 0;
-        currentPhraseGainDb = 0.0f;
-        lastPhraseGainDb = 0.0f;
-        silenceSampleCount = 0;
-        phraseGainSmoother = 0.0f;
-        phraseLastLevelDb = -100.0f;
+        for (auto& core : rideCores)
+            core.resetPhrase();
     }
     
-    // Noise floor threshold - signals below this are treated as silence
-    float noiseFloorThreshold = noiseFloorDb.load();
-    bool useNoiseFloor = noiseFloorThreshold > -59.9f;  // Active when above minimum (-60 dB)
-    
-    for (int sample = 0; sample < numSamples; ++sample)
+    // === A/B SHADOW: pick up new shadow settings, swap live/shadow on A/B switch ===
+    const bool shadowActive = shadowEngineEnabled.load();
+    if (shadowActive)
     {
-        // Use FILTERED signal for level detection (frequency-weighted)
-        float rmsLevelDb = rmsDetector.processSample(filteredRead[sample]);
-        float peakLevelDb = peakDetector.processSample(filteredRead[sample]);
-        
-        // === NOISE GATE LOGIC ===
-        float currentLevel = juce::jmax(rmsLevelDb, peakLevelDb);
-        float smoothCoeff = (currentLevel > gateSmoothedLevel) ? gateSmoothAttack : gateSmoothRelease;
-        gateSmoothedLevel = smoothCoeff * gateSmoothedLevel + (1.0f - smoothCoeff) * currentLevel;
-        
-        // Gate with hysteresis
-        if (!gateOpen && gateSmoothedLevel > gateThresholdDb + gateHysteresisDb)
-            gateOpen = true;
-        else if (gateOpen && gateSmoothedLevel < gateThresholdDb)
-            gateOpen = false;
+        if (shadowNeedsReset.exchange(false))
+            shadowCore().reset();
         
-        float targetGainDb = 0.0f;
-        
-        // === NOISE FLOOR CHECK ===
-        // If noise floor is active and current level is below it, skip gain calculation
-        bool belowNoiseFloor = false;
-        if (useNoiseFloor && currentLevel < noiseFloorThreshold)
-        {
-            belowNoiseFloor = true;
-            targetGainDb = getSilenceGainDb();  // Apply silence gain (0 or -6dB with smart silence)
-        }
-        
-        if (!belowNoiseFloor && useNaturalMode)
+        if (shadowSettingsChanged.load())
         {
-            // === PHRASE-BASED (NATURAL) MODE ===
-            // Use smoothed RMS level (already computed) for stable phrase detection
-            // This avoids the noise from per-sample level analysis
-            
-            float sampleValue = filteredRead[sample];
-            
-            // Use the already-computed RMS level for phrase detection (much more stable)
-            bool audioPresent = rmsLevelDb > gateThresholdDb;
-            
-            // Track smoothed energy changes for phrase boundary detection
-            // Use exponential smoothing on RMS level for stable energy tracking
-            float smoothCoeffPhrase = 0.995f;  // Very smooth tracking
-            float smoothedPhraseLevel = smoothCoeffPhrase * phraseLastLevelDb + (1.0f - smoothCoeffPhrase) * rmsLevelDb;
-            float energyDelta = std::abs(smoothedPhraseLevel - phraseLastLevelDb);
-            phraseLastLevelDb = smoothedPhraseLevel;
-            
-            // Only detect energy jumps when the change is genuinely large AND sustained
-            bool energyJump = (energyDelta > 6.0f && rmsLevelDb > gateThresholdDb + 8.0f 
-                              && phraseSampleCount > phraseMinSamples * 2);
-            
-            if (audioPresent)
+            const juce::SpinLock::ScopedTryLockType lock(shadowSettingsLock);
+            if (lock.isLocked())
             {
-                // Audio present
-                silenceSampleCount = 0;
+                const RideSettings previousShadowSettings = shadowSettings;
+                shadowSettings = pendingShadowSettings;
+                shadowSettingsChanged.store(false);
                 
-                // Start new phrase on: first audio after silence, OR very significant energy jump
-                bool currentlyInPhrase = inPhrase.load();
-                if (!currentlyInPhrase)
-                {
-                    // Start new phrase after silence
-                    inPhrase.store(true);
-                    phraseStartSample = sample;
-                    phraseAccumulator = 0.0f;
-                    phraseSampleCount = 0;
-                    lastPhraseGainDb = currentPhraseGainDb;
-                }
-                else if (energyJump)
+                // The shadow has been riding the new settings all along, so it
+                // becomes live already converged; fade over from the old ride
+                if (shadowSwapRequested.exchange(false))
                 {
-                    // Soft reset for energy-based phrase change (keep some history)
-                    phraseAccumulator *= 0.5f;
-                    phraseSampleCount = static_cast<int>(phraseSampleCount * 0.5f);
-                }
-                
-                // Accumulate for phrase level calculation
-                phraseAccumulator += sampleValue * sampleValue;
-                phraseSampleCount++;
-                
-                // Calculate running phrase level and gain
-                if (phraseSampleCount > phraseMinSamples / 4)  // After initial samples
-                {
-                    float phraseRms = std::sqrt(phraseAccumulator / static_cast<float>(phraseSampleCount));
-                    float phraseLevelDb = juce::Decibels::gainToDecibels(phraseRms, -100.0f);
-                    float gainNeeded = targetLevel - phraseLevelDb;
-                    
-                    // === BREATH REDUCTION (integrated) ===
-                    if (doBreathDetection && isBreath)
-                    {
-                        gainNeeded = juce::jmin(gainNeeded, -breathReduce);
-                    }
-                    
-                    // === TRANSIENT PRESERVATION (integrated) ===
-                    if (doTransientPreservation && peakLevelDb > rmsLevelDb + 6.0f)
-                    {
-                        // Reduce gain adjustment during transients to preserve dynamics
-                        float transientAmount = (peakLevelDb - rmsLevelDb - 6.0f) / 12.0f;
-                        transientAmount = juce::jlimit(0.0f, 1.0f, transientAmount) * transientPres;
-                        gainNeeded *= (1.0f - transientAmount * 0.7f);
-                    }
-                    
-                    // Soft knee for phrase gain
-                    if (std::abs(gainNeeded) < kneeWidthDb)
-                    {
-                        float ratio = gainNeeded / kneeWidthDb;
-                        gainNeeded = gainNeeded * (0.5f + 0.5f * ratio * ratio * (gainNeeded > 0 ? 1.0f : -1.0f));
-                    }
-                    
-                    currentPhraseGainDb = juce::jlimit(-cutRange, boostRange, gainNeeded);
+                    liveCoreIndex = 1 - liveCoreIndex;
+                    shadowCrossfadeRemaining = shadowCrossfadeLength;
                     
-                    // === PEAK-AWARE GAIN LIMITING (Natural Mode) ===
-                    // Same protection as Standard mode: prevent boost from clipping peaks
-                    if (currentPhraseGainDb > 0.0f)
-                    {
-                        static constexpr float peakSafeCeiling = -1.0f;
-                        float peakAfterGain = peakLevelDb + currentPhraseGainDb;
-                        if (peakAfterGain > peakSafeCeiling)
-                        {
-                            currentPhraseGainDb = juce::jmax(0.0f, peakSafeCeiling - peakLevelDb);
-                        }
-                    }
+                    // Keep the new live ride on the settings it converged on:
+                    // snap the parameter smoothing instead of slewing back
+                    // from the old target
+                    smoothedTargetLevel = previousShadowSettings.targetDb;
+                    smoothedBoostRange = previousShadowSettings.boostRangeDb;
+                    smoothedCutRange = previousShadowSettings.cutRangeDb;
+                    rideSettings.copyRideControlsFrom(previousShadowSettings);
+                    if (sidechainDrivesTarget)
+                        rideSettings.targetDb = effectiveTarget;
                 }
             }
-            else
-            {
-                // Silence detected
-                silenceSampleCount++;
-                
-                // Use hold time concept: don't end phrase immediately
-                int holdSamplesForPhrase = static_cast<int>(holdMs.load() * safeSampleRate / 1000.0);
-                holdSamplesForPhrase = juce::jmax(holdSamplesForPhrase, silenceMinSamples);
-                
-                if (inPhrase.load() && silenceSampleCount > holdSamplesForPhrase)
-                {
-                    // End of phrase detected
-                    inPhrase.store(false);
-                    phraseEndSample = sample;
-                }
-            }
-            
-            // Target gain: phrase gain when in phrase, silence gain otherwise
-            float targetPhraseGain = inPhrase.load() ? currentPhraseGainDb : getSilenceGainDb();
-            
-            // Use attack/release coefficients for smooth gain transitions
-            float gainDelta = targetPhraseGain - phraseGainSmoother;
-            float phraseSmooth;
-            if (gainDelta > 0)
-            {
-                // Gain increasing (boost) - use attack time (slower for natural feel)
-                float effectiveAttack = attackMs.load() * 1.5f;  // Natural mode uses slightly slower attack
-                phraseSmooth = std::exp(-1.0f / (effectiveAttack * static_cast<float>(safeSampleRate) / 1000.0f));
-            }
-            else
-            {
-                // Gain decreasing (cut) - use release time (slower for natural feel)
-                float effectiveRelease = releaseMs.load() * 1.5f;  // Natural mode uses slightly slower release
-                phraseSmooth = std::exp(-1.0f / (effectiveRelease * static_cast<float>(safeSampleRate) / 1000.0f));
-            }
-            
-            phraseGainSmoother = phraseSmooth * phraseGainSmoother + (1.0f - phraseSmooth) * targetPhraseGain;
-            
-            targetGainDb = phraseGainSmoother;
-            
-            // Don't boost silence (apply smart silence reduction if enabled)
-            if (!gateOpen)
-            {
-                targetGainDb = juce::jmin(targetGainDb, getSilenceGainDb());
-            }
-        }
-        else if (!belowNoiseFloor)
-        {
-            // === STANDARD MODE (sample-by-sample) ===
-            
-            // Blend peak and RMS for transient sensitivity
-            float effectiveLevelDb;
-            
-            // Use LUFS or RMS based on mode
-            float baseLevelDb = useLufs ? measuredLufs : rmsLevelDb;
-            
-            if (peakLevelDb > baseLevelDb + 3.0f)
-            {
-                effectiveLevelDb = baseLevelDb + (peakLevelDb - baseLevelDb) * 0.7f;
-            }
-            else
-            {
-                effectiveLevelDb = baseLevelDb;
-            }
-            
-            // If using predictive look-ahead, blend with peak-ahead levels
-            if (useLookAhead)
-            {
-                float peakAhead = peakAheadLevels[static_cast<size_t>(sample)];
-                if (peakAhead > effectiveLevelDb)
-                {
-                    effectiveLevelDb = effectiveLevelDb + (peakAhead - effectiveLevelDb) * 0.6f;
-                }
-            }
-            
-            // Calculate target gain
-            float gainNeeded = targetLevel - effectiveLevelDb;
-            
-            // === BREATH REDUCTION ===
-            if (doBreathDetection && isBreath)
-            {
-                // If breath detected, reduce gain by breathReductionDb
-                gainNeeded = juce::jmin(gainNeeded, -breathReduce);
-            }
-            
-            // === TRANSIENT PRESERVATION (Standard Mode) ===
-            if (doTransientPreservation && peakLevelDb > rmsLevelDb + 6.0f)
-            {
-                // Reduce gain adjustment during transients to preserve dynamics
-                float transientAmount = (peakLevelDb - rmsLevelDb - 6.0f) / 12.0f;
-                transientAmount = juce::jlimit(0.0f, 1.0f, transientAmount) * transientPres;
-                gainNeeded *= (1.0f - transientAmount * 0.7f);
-            }
-            
-            // Soft knee
-            if (std::abs(gainNeeded) < kneeWidthDb)
-            {
-                float ratio = gainNeeded / kneeWidthDb;
-                gainNeeded = gainNeeded * (0.5f + 0.5f * ratio * ratio * (gainNeeded > 0 ? 1.0f : -1.0f));
-            }
-            
-            targetGainDb = juce::jlimit(-cutRange, boostRange, gainNeeded);
-            
-            // === PEAK-AWARE GAIN LIMITING ===
-            // Prevent boost from pushing peaks past the soft clipper ceiling.
-            // Without this, the RMS-based gain decision can boost hot signals into clipping
-            // because RMS is always lower than peak (crest factor).
-            if (targetGainDb > 0.0f)
-            {
-                static constexpr float peakSafeCeiling = -1.0f;  // dB headroom below 0 dBFS
-                float peakAfterGain = peakLevelDb + targetGainDb;
-                if (peakAfterGain > peakSafeCeiling)
-                {
-                    targetGainDb = juce::jmax(0.0f, peakSafeCeiling - peakLevelDb);
-                }
-            }
-            
-            // Noise gate: Apply smart silence reduction if enabled
-            if (!gateOpen)
-            {
-                targetGainDb = juce::jmin(targetGainDb, getSilenceGainDb());
-            }
-            
-            if (effectiveLevelDb < gateThresholdDb - 10.0f)
-            {
-                targetGainDb = juce::jmin(targetGainDb, 0.0f);
-            }
         }
+    }
+    else
+    {
+        shadowSwapRequested.store(false);
+        shadowCrossfadeRemaining = 0;
+    }
+    
+    // === DETECTION FRONT-END ===
+    // Vocal focus filter, RMS/peak envelopes, LUFS, breath detection and the
+    // predictive peak-ahead scan all run on the mono input (see RideDetector).
+    // Both rides read the same detector, so the block-level analyses run if
+    // either side needs them; a shadow then swaps in with current breath and
+    // LUFS state.
+    if (lufsNeedsReset.exchange(false))
+        rideDetector.resetLufs();
+    
+    RideSettings detectorSettings = rideSettings;
+    if (shadowActive)
+    {
+        detectorSettings.useLufs = detectorSettings.useLufs || shadowSettings.useLufs;
+        detectorSettings.breathReductionDb = juce::jmax(detectorSettings.breathReductionDb,
+                                                        shadowSettings.breathReductionDb);
+    }
+    
+    rideDetector.process(monoRead, numSamples, detectorSettings);
+    rideHistory.push(rideDetector, numSamples);
+    
+    if (rideSettings.useLufs)
+        inputLufs.store(rideDetector.getLufs());
+    
+    // === RIDE: per-sample gain decision (Natural or Standard mode) + smoothing ===
+    auto& rideCore = liveCore();
+    rideCore.setSettings(rideSettings);
+    rideCore.setGainOverride(useAutomationGain, automationGainDb);
+    rideCore.processBlock(rideDetector, numSamples, gainSamples.data());
+    inPhrase.store(rideCore.isInPhrase());
+    
+    // Shadow ride: same detector output, its own gate/phrase/smoother state.
+    // Only the front-end settings follow the live side.
+    if (shadowActive)
+    {
+        RideSettings shadowBlockSettings = rideSettings;
+        shadowBlockSettings.copyRideControlsFrom(shadowSettings);
+        
+        // The sidechain sets the target for whichever side is live
+        if (sidechainDrivesTarget)
+            shadowBlockSettings.targetDb = effectiveTarget;
         
-        // === READ MODE: Override calculated gain with DAW automation ===
-        if (useAutomationGain)
+        auto& shadow = shadowCore();
+        shadow.setSettings(shadowBlockSettings);
+        shadow.setGainOverride(false, 0.0f);
+        shadow.processBlock(rideDetector, numSamples, scratchShadowGainSamples.data());
+    }
+    
+    #if JucePlugin_Build_Standalone
+    // Loop render: the live ride keeps running for the meters, but the output
+    // uses the pre-rendered curve (look-ahead is already baked into it)
+    if (useRenderedGain)
+        std::copy_n(scratchLoopGainDb.begin(), numSamples, gainSamples.begin());
+    #endif
+
+    // Pre-compute linear gain values (pre-allocated)
+    auto& precomputedGains = scratchPrecomputedGains;
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        precomputedGains[static_cast<size_t>(sample)] =
+            juce::Decibels::decibelsToGain(gainSamples[static_cast<size_t>(sample)]);
+    }
+    
+    // A/B crossfade: blend from the previous ride (now the shadow) into the new one
+    if (shadowCrossfadeRemaining > 0 && !useRenderedGain)
+    {
+        for (int sample = 0; sample < numSamples && shadowCrossfadeRemaining > 0; ++sample)
         {
-            targetGainDb = automationGainDb;  // Use the gain from DAW automation
+            const auto idx = static_cast<size_t>(sample);
+            const float fade = 1.0f - static_cast<float>(shadowCrossfadeRemaining)
+                                        / static_cast<float>(shadowCrossfadeLength);
+            const float oldGain = juce::Decibels::decibelsToGain(scratchShadowGainSamples[idx]);
+            precomputedGains[idx] = oldGain + (precomputedGains[idx] - oldGain) * fade;
+            --shadowCrossfadeRemaining;
         }
-        
-        float smoothedGainDb = gainSmoother.processSample(targetGainDb);
-        
-        gainSamples[static_cast<size_t>(sample)] = smoothedGainDb;
-        precomputedGains[static_cast<size_t>(sample)] = juce::Decibels::decibelsToGain(smoothedGainDb);
     }
 
     // Apply gain with or without look-ahead
     const int currentLookAheadSamples = lookAheadSamples.load();  // Cache atomic for tight loop
-    if (useLookAhead && currentLookAheadSamples > 0)
+    if (useLookAhead && currentLookAheadSamples > 0 && !useRenderedGain)
     {
         // LOOK-AHEAD PROCESSING
         // The audio is delayed by currentLookAheadSamples, but gains are computed from
@@ -1222,7 +939,8 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         }
     }
 
-    float finalGainDb = gainSmoother.getCurrentGainDb();
+    float finalGainDb = useRenderedGain ? gainSamples[static_cast<size_t>(numSamples - 1)]
+                                        : liveCore().getCurrentGainDb();
     currentGainDb.store(finalGainDb);
     
     // === AUTOMATION OUTPUT ===
@@ -1319,6 +1037,12 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         }
     }
 
+    #if JucePlugin_Build_Standalone
+    // Record processed output + gain curve (lock-free, drops rather than blocks)
+    // gainSamples[i] is the gain already applied to output sample i, so no alignment is needed
+    recorder.push(buffer.getArrayOfReadPointers(), numChannels, gainSamples.data(), numSamples);
+    #endif
+
     // Output samples for waveform display (mono average for RMS-based display)
     auto& outputSamples = scratchOutputSamples;
     {
@@ -1345,6 +1069,12 @@ void VocalRiderAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     if (numChannels > 1)
         outputRmsLevel = juce::jmax(outputRmsLevel, buffer.getRMSLevel(1, 0, numSamples));
     outputLevelDb.store(juce::Decibels::gainToDecibels(outputRmsLevel, -100.0f));
+
+    // Dashboard: CPU and gain for this block (relaxed stores only)
+    if (registrySlot != nullptr)
+        registrySlot->publishBlock(numSamples, currentSampleRate,
+                                   juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - blockStartTicks),
+                                   currentGainDb.load());
 }
 
 //==============================================================================
@@ -1378,6 +1108,8 @@ void VocalRiderAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
     state.setProperty("scrollSpeed", scrollSpeedSetting.load(), nullptr);
     state.setProperty("presetIndex", currentPresetIndex.load(), nullptr);
     state.setProperty("windowSizeIndex", windowSizeIndex.load(), nullptr);
+    state.setProperty("editorWidth", editorWidth.load(), nullptr);
+    state.setProperty("editorHeight", editorHeight.load(), nullptr);
     
     // Range lock state
     state.setProperty("rangeLocked", rangeLocked.load(), nullptr);
@@ -1459,6 +1191,9 @@ void VocalRiderAudioProcessor::setStateInformation(const void* data, int sizeInB
             setCurrentPresetIndex(static_cast<int>(state.getProperty("presetIndex")));
         if (state.hasProperty("windowSizeIndex"))
             setWindowSizeIndex(static_cast<int>(state.getProperty("windowSizeIndex")));
+        if (state.hasProperty("editorWidth") && state.hasProperty("editorHeight"))
+            setEditorSize(static_cast<int>(state.getProperty("editorWidth")),
+                          static_cast<int>(state.getProperty("editorHeight")));
         
         // Sidechain / vocal focus settings
         if (state.hasProperty("sidechainEnabled"))
@@ -1588,107 +1323,51 @@ void VocalRiderAudioProcessor::setAutomationMode(AutomationMode mode)
     automationWriteActive.store(false);
 }
 
-//==============================================================================
-// Helper functions for advanced detection
-
-float VocalRiderAudioProcessor::calculateLufs(const float* samples, int numSamples)
+void VocalRiderAudioProcessor::setShadowEngineEnabled(bool enabled)
 {
-    // Simplified LUFS calculation with K-weighting approximation
-    float sumSquared = 0.0f;
-    
-    for (int i = 0; i < numSamples; ++i)
-    {
-        // Apply K-weighting (simplified)
-        float filtered = lufsPreFilter.processSample(0, samples[i]);
-        filtered = lufsHighShelf.processSample(0, filtered) * 1.4f + filtered;  // Boost highs
-        sumSquared += filtered * filtered;
-    }
-    
-    lufsIntegrator += sumSquared;
-    lufsSampleCount += numSamples;
-    
-    // Prevent unbounded accumulation: use ~3 second sliding window
-    // Reset when we exceed the window, preserving recent average
-    int maxLufsSamples = static_cast<int>(3.0 * currentSampleRate);
-    if (maxLufsSamples > 0 && lufsSampleCount > maxLufsSamples)
-    {
-        // Decay integrator to approximate sliding window
-        float ratio = static_cast<float>(maxLufsSamples) / static_cast<float>(lufsSampleCount);
-        lufsIntegrator *= ratio;
-        lufsSampleCount = maxLufsSamples;
-    }
-    
-    if (lufsSampleCount > 0)
-    {
-        float meanSquared = lufsIntegrator / static_cast<float>(lufsSampleCount);
-        float rms = std::sqrt(meanSquared);
-        return juce::Decibels::gainToDecibels(rms, -100.0f) - 0.691f;  // LUFS offset
-    }
-    
-    return -100.0f;
+    if (enabled && !shadowEngineEnabled.load())
+        shadowNeedsReset.store(true);
+    shadowEngineEnabled.store(enabled);
 }
 
-float VocalRiderAudioProcessor::calculateSpectralFlatness(const float* samples, int numSamples)
+void VocalRiderAudioProcessor::setShadowSettings(const RideSettings& settings)
 {
-    // Spectral flatness: ratio of geometric mean to arithmetic mean
-    // High value = noise-like (breath), Low value = tonal (voice)
-    
-    if (numSamples < 2) return 0.0f;
-    
-    float sumAbs = 0.0f;
-    float sumLog = 0.0f;
-    int validSamples = 0;
-    
-    // On older hardware, downsample for large blocks to reduce expensive log() calls
-    int step = (numSamples > 256) ? 4 : 1;
-    
-    for (int i = 0; i < numSamples; i += step)
-    {
-        float absVal = std::abs(samples[i]);
-        if (absVal > 1e-10f)
-        {
-            sumAbs += absVal;
-            sumLog += std::log(absVal);
-            validSamples++;
-        }
-    }
-    
-    if (validSamples < 2) return 0.0f;
-    
-    float arithmeticMean = sumAbs / static_cast<float>(validSamples);
-    float geometricMean = std::exp(sumLog / static_cast<float>(validSamples));
-    
-    if (arithmeticMean < 1e-10f) return 0.0f;
-    
-    return geometricMean / arithmeticMean;
+    const juce::SpinLock::ScopedLockType lock(shadowSettingsLock);
+    pendingShadowSettings = settings;
+    shadowSettingsChanged.store(true);
 }
 
-float VocalRiderAudioProcessor::calculateZeroCrossingRate(const float* samples, int numSamples)
+void VocalRiderAudioProcessor::swapWithShadow(const RideSettings& newShadowSettings)
 {
-    if (numSamples < 2) return 0.0f;
-    
-    int crossings = 0;
-    for (int i = 1; i < numSamples; ++i)
-    {
-        if ((samples[i] >= 0.0f) != (samples[i - 1] >= 0.0f))
-            crossings++;
-    }
-    
-    return static_cast<float>(crossings) / static_cast<float>(numSamples - 1);
+    const juce::SpinLock::ScopedLockType lock(shadowSettingsLock);
+    pendingShadowSettings = newShadowSettings;
+    shadowSwapRequested.store(true);
+    shadowSettingsChanged.store(true);
 }
 
-bool VocalRiderAudioProcessor::detectBreath(float spectralFlatness, float zeroCrossRate)
+//==============================================================================
+// Helper functions for advanced detection
+
+RideSettings VocalRiderAudioProcessor::getRideSettings() const
 {
-    // Breaths have: high spectral flatness (noisy), high zero-crossing rate
-    // Voice has: low spectral flatness (tonal), moderate zero-crossing rate
-    
-    bool likelyBreath = (spectralFlatness > 0.3f && zeroCrossRate > 0.2f);
-    
-    // Smooth the breath detection
-    float target = likelyBreath ? 1.0f : 0.0f;
-    breathEnvelope = 0.95f * breathEnvelope + 0.05f * target;
-    
-    return breathEnvelope > 0.5f;
+    RideSettings settings;
+    settings.targetDb = targetLevelParam->load();
+    settings.boostRangeDb = boostRangeParam->load();
+    settings.cutRangeDb = cutRangeParam->load();
+    settings.speed = speedParam->load();
+    settings.attackMs = attackMs.load();
+    settings.releaseMs = releaseMs.load();
+    settings.holdMs = holdMs.load();
+    settings.breathReductionDb = breathReductionDb.load();
+    settings.transientPreservation = transientPreservation.load();
+    settings.noiseFloorDb = noiseFloorDb.load();
+    settings.naturalMode = naturalModeEnabled.load();
+    settings.smartSilence = smartSilenceEnabled.load();
+    settings.vocalFocus = vocalFocusEnabled.load();
+    settings.useLufs = useLufsMode.load();
+    settings.useLookAhead = isLookAheadEnabled();
+    settings.lookAheadSamples = lookAheadSamples.load();
+    return settings;
 }
 
 void VocalRiderAudioProcessor::separateTransientSustain(float sample, float& transient, float& sustain)
@@ -1967,6 +1646,7 @@ void VocalRiderAudioProcessor::loadPresetFromData(const Preset& preset)
 bool VocalRiderAudioProcessor::loadAudioFile(const juce::File& file)
 {
     stopPlayback();
+    loopRenderer.clearRegion();
     
     auto* reader = formatManager.createReaderFor(file);
     
@@ -1976,6 +1656,7 @@ bool VocalRiderAudioProcessor::loadAudioFile(const juce::File& file)
         transportSource.setSource(newSource.get(), 0, nullptr, reader->sampleRate);
         readerSource = std::move(newSource);
         loadedFileName = file.getFileName();
+        loadedFile = file;
         fileLoaded.store(true);
         return true;
     }
@@ -2019,6 +1700,49 @@ void VocalRiderAudioProcessor::rewindPlayback()
     transportSource.setPosition(0.0);
 }
 
+void VocalRiderAudioProcessor::setPlaybackPosition(double seconds)
+{
+    // Seeking outside the loop region drops the loop
+    if (loopRenderer.hasRegion()
+        && (seconds < loopRenderer.getStartSeconds() || seconds >= loopRenderer.getEndSeconds()))
+        clearLoopRegion();
+
+    if (fileLoaded.load())
+        transportSource.setPosition(juce::jlimit(0.0, transportSource.getLengthInSeconds(), seconds));
+}
+
+void VocalRiderAudioProcessor::setLoopRegion(double startSeconds, double endSeconds)
+{
+    if (!fileLoaded.load())
+        return;
+
+    const double length = transportSource.getLengthInSeconds();
+    startSeconds = juce::jlimit(0.0, length, startSeconds);
+    endSeconds = juce::jlimit(0.0, length, endSeconds);
+    if (endSeconds - startSeconds < 0.1)
+        return;
+
+    if (loopRenderer.setRegion(loadedFile, startSeconds, endSeconds, getRideSettings()))
+        transportSource.setPosition(startSeconds);
+}
+
+void VocalRiderAudioProcessor::clearLoopRegion()
+{
+    if (!loopRenderer.hasRegion())
+        return;
+
+    // Carry on from where the loop was
+    const double position = loopRenderer.getPlaybackPosition();
+    loopRenderer.clearRegion();
+    transportSource.setPosition(position);
+}
+
+bool VocalRiderAudioProcessor::isSupportedAudioFile(const juce::File& file)
+{
+    return file.existsAsFile()
+        && formatManager.findFormatForFileExtension(file.getFileExtension()) != nullptr;
+}
+
 bool VocalRiderAudioProcessor::hasPlaybackFinished() const
 {
     if (!fileLoaded.load()) return false;
@@ -2027,6 +1751,8 @@ bool VocalRiderAudioProcessor::hasPlaybackFinished() const
 
 double VocalRiderAudioProcessor::getPlaybackPosition() const
 {
+    if (loopRenderer.hasRegion())
+        return loopRenderer.getPlaybackPosition();
     return transportSource.getCurrentPosition();
 }
 
@@ -2034,6 +1760,26 @@ double VocalRiderAudioProcessor::getPlaybackLength() const
 {
     return transportSource.getLengthInSeconds();
 }
+
+bool VocalRiderAudioProcessor::startRecording(const juce::File& file)
+{
+    double sr = getSampleRate();
+    if (sr <= 0.0) sr = 44100.0;
+    return recorder.start(file, sr, juce::jmax(1, getMainBusNumOutputChannels()));
+}
+
+void VocalRiderAudioProcessor::stopRecording()
+{
+    recorder.stop();
+}
+
+juce::File VocalRiderAudioProcessor::getRecordingsFolder()
+{
+    auto recordingsDir = juce::File::getSpecialLocation(juce::File::userMusicDirectory)
+                             .getChildFile("magic.RIDE Recordings");
+    recordingsDir.createDirectory();
+    return recordingsDir;
+}
 #endif
 
 //==============================================================================
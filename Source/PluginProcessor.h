@@ -17,9 +17,15 @@
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <juce_audio_formats/juce_audio_formats.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
 #include "DSP/RMSDetector.h"
-#include "DSP/GainSmoother.h"
-#include "DSP/PeakDetector.h"
+#include "DSP/RideDetector.h"
+#include "DSP/RideCore.h"
+#include "DSP/RideHistory.h"
+#include "DSP/RidePreviewRenderer.h"
+#include "IO/RideRecorder.h"
+#include "IO/InstanceRegistry.h"
+#include "IO/LoopRenderer.h"
 #include "UI/WaveformDisplay.h"
 
 //==============================================================================
@@ -58,6 +64,10 @@ public:
     bool producesMidi() const override;
     bool isMidiEffect() const override;
     double getTailLengthSeconds() const override;
+    
+    // Track name from the host, shown in the instance dashboard
+    void updateTrackProperties(const TrackProperties& properties) override;
+    int getRegistrySlotIndex() const { return registrySlot != nullptr ? registrySlot->getIndex() : -1; }
 
     //==============================================================================
     int getNumPrograms() override;
@@ -105,6 +115,23 @@ public:
     bool isNaturalModeEnabled() const { return naturalModeEnabled.load(); }
     bool isInPhrase() const { return inPhrase.load(); }  // For visual feedback (atomic for thread safety)
     
+    // Snapshot of the current ride settings (unsmoothed, no sidechain) for offline renders
+    RideSettings getRideSettings() const;
+    
+    // What-if preview: re-runs the ride over the recent detector history with
+    // the current settings in the background (e.g. while dragging target/range)
+    void requestRidePreview() { ridePreviewRenderer.requestPreview(getRideSettings()); }
+    std::shared_ptr<const RidePreview> getLatestRidePreview() const { return ridePreviewRenderer.getLatestPreview(); }
+    juce::int64 getRideHistoryFramesWritten() const { return rideHistory.getFramesWritten(); }
+    
+    // Seamless A/B: a shadow ride runs the inactive A/B settings on the shared
+    // detector, so switching is a short crossfade between two converged rides
+    void setShadowEngineEnabled(bool enabled);
+    bool isShadowEngineEnabled() const { return shadowEngineEnabled.load(); }
+    void setShadowSettings(const RideSettings& settings);
+    // Swaps live and shadow rides; the shadow then runs newShadowSettings (old live)
+    void swapWithShadow(const RideSettings& newShadowSettings);
+    
     // Smart Silence (silence reduction)
     void setSmartSilenceEnabled(bool enabled) { smartSilenceEnabled.store(enabled); }
     bool isSmartSilenceEnabled() const { return smartSilenceEnabled.load(); }
@@ -163,6 +190,11 @@ public:
     void setWindowSizeIndex(int index) { windowSizeIndex.store(index); }
     int getWindowSizeIndex() const { return windowSizeIndex.load(); }
     
+    // Free-dragged editor size in unscaled pixels (saved in state; 0 = use the preset)
+    void setEditorSize(int width, int height) { editorWidth.store(width); editorHeight.store(height); }
+    int getEditorWidth() const { return editorWidth.load(); }
+    int getEditorHeight() const { return editorHeight.load(); }
+    
     // Automation write mode
     void setAutomationMode(AutomationMode mode);
     AutomationMode getAutomationMode() const { return automationMode.load(); }
@@ -250,54 +282,73 @@ public:
     void stopPlayback();
     void togglePlayback();
     void rewindPlayback();
+    void setPlaybackPosition(double seconds);
     bool isPlaying() const { return transportPlaying.load(); }
     bool hasPlaybackFinished() const;
     double getPlaybackPosition() const;
     double getPlaybackLength() const;
     juce::String getLoadedFileName() const { return loadedFileName; }
+    juce::File getLoadedFile() const { return loadedFile; }
+    bool isSupportedAudioFile(const juce::File& file);
     bool hasFileLoaded() const { return fileLoaded.load(); }
+
+    // Output recording (processed audio + per-sample gain curve)
+    bool startRecording(const juce::File& file);
+    void stopRecording();
+    bool isRecording() const { return recorder.isRecording(); }
+    const RideRecorder& getRecorder() const { return recorder; }
+    static juce::File getRecordingsFolder();
+
+    // Loop region: cached in RAM and re-rendered in the background on every
+    // settings change; playback switches to the new render at the loop boundary
+    void setLoopRegion(double startSeconds, double endSeconds);
+    void clearLoopRegion();
+    bool hasLoopRegion() const { return loopRenderer.hasRegion(); }
+    const LoopRenderer& getLoopRenderer() const { return loopRenderer; }
     #endif
 
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     float softClip(float sample);
-    float calculateLufs(const float* samples, int numSamples);
-    bool detectBreath(float spectralFlatness, float zeroCrossRate);
-    float calculateSpectralFlatness(const float* samples, int numSamples);
-    float calculateZeroCrossingRate(const float* samples, int numSamples);
     void separateTransientSustain(float sample, float& transient, float& sustain);
 
     //==============================================================================
     juce::AudioProcessorValueTreeState apvts;
 
-    // DSP components
-    RMSDetector rmsDetector;
-    GainSmoother gainSmoother;
-    PeakDetector peakDetector;
-    
-    // Sidechain filters for spectral focus (200Hz - 4kHz vocal range)
-    juce::dsp::StateVariableTPTFilter<float> sidechainHPF;  // High-pass at 200Hz
-    juce::dsp::StateVariableTPTFilter<float> sidechainLPF;  // Low-pass at 4kHz
+    // This instance's entry in the process-wide dashboard registry (may be null)
+    InstanceRegistry::Slot* registrySlot = nullptr;
+    juce::uint32 getRegistryModeFlags() const;
+    
+    // DSP components: detection front-end (filters, envelopes, LUFS, breath)
+    // feeding the gain decision + smoothing stage. Two ride cores share the
+    // detector; the one not live is the A/B shadow.
+    RideDetector rideDetector;
+    RideHistory rideHistory;
+    RidePreviewRenderer ridePreviewRenderer { rideHistory };
+    std::array<RideCore, 2> rideCores;
+    int liveCoreIndex = 0;
+    RideCore& liveCore() { return rideCores[static_cast<size_t>(liveCoreIndex)]; }
+    RideCore& shadowCore() { return rideCores[static_cast<size_t>(1 - liveCoreIndex)]; }
+    
+    // Shadow engine (A/B). Settings are handed over with a try-lock so the audio
+    // thread never waits; a swap is only applied together with its settings.
+    std::atomic<bool> shadowEngineEnabled { false };
+    std::atomic<bool> shadowNeedsReset { false };
+    std::atomic<bool> shadowSettingsChanged { false };
+    std::atomic<bool> shadowSwapRequested { false };
+    juce::SpinLock shadowSettingsLock;
+    RideSettings pendingShadowSettings;
+    RideSettings shadowSettings;                // Audio thread copy
+    int shadowCrossfadeRemaining = 0;
+    int shadowCrossfadeLength = 0;
+    static constexpr double shadowCrossfadeSeconds = 0.03;
     
     // Transient detection filter
     juce::dsp::StateVariableTPTFilter<float> transientHPF;  // For transient detection
     float transientEnvelope = 0.0f;
     float sustainEnvelope = 0.0f;
     
-    // Noise gate parameters
-    static constexpr float gateThresholdDb = -45.0f;
-    static constexpr float gateHysteresisDb = 3.0f;
-    static constexpr float silenceGainDbReduction = -6.0f;  // When smart silence is ON
-    bool gateOpen = false;
-    float gateSmoothedLevel = -100.0f;
-    
-    // Smart Silence helper
-    float getSilenceGainDb() const { return smartSilenceEnabled.load() ? silenceGainDbReduction : 0.0f; }
-    
-    // Soft knee parameters
-    static constexpr float kneeWidthDb = 6.0f;
-    
     //==============================================================================
     // Phrase-based processing (Natural Mode)
     std::atomic<bool> naturalModeEnabled { true };  // Default ON
@@ -309,6 +360,8 @@ private:
     std::atomic<float> scrollSpeedSetting { 0.5f };  // Default to medium (50%)
     std::atomic<int> currentPresetIndex { 0 };  // 0 = no preset selected
     std::atomic<int> windowSizeIndex { 1 };  // 0=Small, 1=Medium, 2=Large (default Medium)
+    std::atomic<int> editorWidth { 0 };
+    std::atomic<int> editorHeight { 0 };
     
     // Learning mode
     std::atomic<bool> isLearning { false };
@@ -317,22 +370,8 @@ private:
     
     std::atomic<bool> inPhrase { false };
     std::atomic<bool> phraseStateNeedsReset { false };  // Flag for thread-safe reset
-    float phraseAccumulator = 0.0f;
-    int phraseSampleCount = 0;
-    float currentPhraseGainDb = 0.0f;
-    float lastPhraseGainDb = 0.0f;
-    int silenceSampleCount = 0;
-    int phraseMinSamples = 0;
-    int silenceMinSamples = 0;
-    float phraseGainSmoother = 0.0f;
-    static constexpr float phraseGainSmoothCoeff = 0.9995f;
     int processorSilenceBlockCount = 0;  // Counter for silent processBlock calls
     
-    // Intelligent phrase boundary detection
-    float phraseLastLevelDb = -100.0f;  // For energy delta tracking
-    int phraseStartSample = 0;           // Sample where current phrase started
-    int phraseEndSample = 0;             // Sample where last phrase ended
-    
     // Phrase lookahead buffer
     std::vector<float> phraseLookaheadBuffer;
     int phraseLookaheadWritePos = 0;
@@ -343,16 +382,10 @@ private:
     std::atomic<bool> useLufsMode { false };
     std::atomic<bool> lufsNeedsReset { false };  // Signal audio thread to reset LUFS state
     std::atomic<float> inputLufs { -100.0f };
-    float lufsIntegrator = 0.0f;
-    int lufsSampleCount = 0;
-    juce::dsp::StateVariableTPTFilter<float> lufsPreFilter;  // K-weighting pre-filter
-    juce::dsp::StateVariableTPTFilter<float> lufsHighShelf;  // K-weighting high shelf
     
     //==============================================================================
     // Breath detection
     std::atomic<float> breathReductionDb { 0.0f };  // 0 = no reduction
-    bool isBreath = false;
-    float breathEnvelope = 0.0f;
     
     //==============================================================================
     // Transient preservation
@@ -377,8 +410,6 @@ private:
     //==============================================================================
     // Vocal focus filter (frequency-weighted detection)
     std::atomic<bool> vocalFocusEnabled { true };  // Default ON for better vocal detection
-    juce::dsp::StateVariableTPTFilter<float> vocalFocusHighPass;  // Cut below ~200Hz
-    juce::dsp::StateVariableTPTFilter<float> vocalFocusLowPass;   // Cut above ~4kHz
     juce::dsp::StateVariableTPTFilter<float> vocalFocusBandBoost; // Boost 1-3kHz presence
     
     //==============================================================================
@@ -427,12 +458,6 @@ private:
     std::atomic<float> outputLevelDb { -100.0f };
     std::atomic<float> currentGainDb { 0.0f };
 
-    // Speed / parameter tracking (avoid redundant coefficient updates)
-    float lastSpeed = -1.0f;
-    float lastAttackMs = -1.0f;
-    float lastReleaseMs = -1.0f;
-    float lastHoldMs = -1.0f;
-
     // Waveform display (non-owning pointer, set by editor) - atomic for thread safety.
     // IMPORTANT: Editor MUST call setWaveformDisplay(nullptr) in its destructor BEFORE
     // the WaveformDisplay is destroyed, to prevent use-after-free on the audio thread.
@@ -478,11 +503,10 @@ private:
     //==============================================================================
     // Pre-allocated scratch buffers for processBlock (avoid heap allocs on audio thread)
     juce::AudioBuffer<float> scratchMonoBuffer;
-    juce::AudioBuffer<float> scratchFilteredBuffer;
     juce::AudioBuffer<float> scratchSidechainBuffer;
     std::vector<float> scratchInputSamples;
     std::vector<float> scratchGainSamples;
-    std::vector<float> scratchPeakAheadLevels;
+    std::vector<float> scratchShadowGainSamples;
     std::vector<float> scratchPrecomputedGains;
     std::vector<float> scratchOutputSamples;
     int preparedBlockSize = 0;  // Track allocated size for overflow guard
@@ -495,7 +519,11 @@ private:
     std::atomic<bool> transportPlaying { false };
     std::atomic<bool> fileLoaded { false };
     juce::String loadedFileName;
+    juce::File loadedFile;
     int currentBlockSize = 512;
+    RideRecorder recorder;
+    LoopRenderer loopRenderer;
+    std::vector<float> scratchLoopGainDb;
     #endif
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VocalRiderAudioProcessor)
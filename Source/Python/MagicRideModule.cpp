@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    MagicRideModule.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+    Python bindings to the ride engine for analysis notebooks (pybind11).
+    Audio comes in as a float32 NumPy array in any layout and is read in
+    place; every stage output is written straight into a freshly allocated
+    NumPy array, so nothing is copied on the way in or out. The GIL is
+    released while the engine runs, so files can be analysed in parallel
+    from Python threads (one Analyzer per thread).
+
+        import magicride
+        stages = magicride.analyze(audio, 48000, magicride.Settings())
+        stages["gain_db"], stages["rms_db"], stages["in_phrase"], ...
+
+  ==============================================================================
+*/
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <limits>
+#include <string>
+#include "DSP/RideStageAnalyzer.h"
+
+namespace py = pybind11;
+using namespace pybind11::literals;
+
+namespace
+{
+    // No forcecast (array_t's default): anything but float32 is rejected rather
+    // than silently copied, even where a binding forgets noconvert()
+    using AudioArray = py::array_t<float, 0>;
+
+    py::dict runAnalyzer(RideStageAnalyzer& analyzer, const AudioArray& audio, int channelAxis)
+    {
+        if (audio.ndim() != 1 && audio.ndim() != 2)
+            throw py::value_error("audio must be 1-D (samples) or 2-D (channels and samples)");
+
+        if (audio.ndim() == 2 && channelAxis != 0 && channelAxis != 1 && channelAxis != -1)
+            throw py::value_error("channel_axis must be 0 or 1");
+
+        const int channelDim = audio.ndim() == 2 ? (channelAxis == 0 ? 0 : 1) : -1;
+        const int sampleDim = audio.ndim() == 2 ? 1 - channelDim : 0;
+
+        const auto numSamples = audio.shape(sampleDim);
+        const auto numChannels = channelDim >= 0 ? audio.shape(channelDim) : py::ssize_t(1);
+        if (numSamples > std::numeric_limits<int>::max() || numChannels > std::numeric_limits<int>::max())
+            throw py::value_error("audio is too long");
+
+        // NumPy strides are in bytes
+        if (audio.strides(sampleDim) % py::ssize_t(sizeof(float)) != 0
+            || (channelDim >= 0 && audio.strides(channelDim) % py::ssize_t(sizeof(float)) != 0))
+            throw py::value_error("audio strides must be whole float32 elements");
+
+        const auto sampleStride = static_cast<std::ptrdiff_t>(audio.strides(sampleDim) / py::ssize_t(sizeof(float)));
+        const auto channelStride = channelDim >= 0
+                                 ? static_cast<std::ptrdiff_t>(audio.strides(channelDim) / py::ssize_t(sizeof(float)))
+                                 : std::ptrdiff_t(0);
+
+        py::array_t<float> rmsDb(numSamples), peakDb(numSamples), peakAheadDb(numSamples);
+        py::array_t<bool> gateOpen(numSamples), inPhrase(numSamples);
+        py::array_t<float> targetGainDb(numSamples), gainDb(numSamples);
+
+        RideStageOutputs outputs;
+        outputs.rmsDb = rmsDb.mutable_data();
+        outputs.peakDb = peakDb.mutable_data();
+        outputs.peakAheadDb = peakAheadDb.mutable_data();
+        outputs.gateOpen = reinterpret_cast<std::uint8_t*>(gateOpen.mutable_data());   // NumPy bools are one byte
+        outputs.inPhrase = reinterpret_cast<std::uint8_t*>(inPhrase.mutable_data());
+        outputs.targetGainDb = targetGainDb.mutable_data();
+        outputs.gainDb = gainDb.mutable_data();
+
+        const float* data = audio.data();
+        {
+            py::gil_scoped_release release;
+            analyzer.process(data, static_cast<int>(numChannels), static_cast<int>(numSamples),
+                             sampleStride, channelStride, outputs);
+        }
+
+        py::dict stages;
+        stages["rms_db"] = rmsDb;
+        stages["peak_db"] = peakDb;
+        stages["peak_ahead_db"] = peakAheadDb;
+        stages["gate_open"] = gateOpen;
+        stages["in_phrase"] = inPhrase;
+        stages["target_gain_db"] = targetGainDb;
+        stages["gain_db"] = gainDb;
+        return stages;
+    }
+}
+
+//==============================================================================
+PYBIND11_MODULE(magicride, m)
+{
+    m.doc() = "magic.RIDE ride engine: per-stage analysis of NumPy audio";
+
+    py::class_<RideSettings>(m, "Settings")
+        .def(py::init<>())
+        .def_readwrite("target_db", &RideSettings::targetDb)
+        .def_readwrite("boost_range_db", &RideSettings::boostRangeDb)
+        .def_readwrite("cut_range_db", &RideSettings::cutRangeDb)
+        .def_readwrite("speed", &RideSettings::speed)
+        .def_readwrite("attack_ms", &RideSettings::attackMs)
+        .def_readwrite("release_ms", &RideSettings::releaseMs)
+        .def_readwrite("hold_ms", &RideSettings::holdMs)
+        .def_readwrite("breath_reduction_db", &RideSettings::breathReductionDb)
+        .def_readwrite("transient_preservation", &RideSettings::transientPreservation)
+        .def_readwrite("noise_floor_db", &RideSettings::noiseFloorDb)
+        .def_readwrite("natural_mode", &RideSettings::naturalMode)
+        .def_readwrite("smart_silence", &RideSettings::smartSilence)
+        .def_readwrite("vocal_focus", &RideSettings::vocalFocus)
+        .def_readwrite("use_lufs", &RideSettings::useLufs)
+        .def_readwrite("use_look_ahead", &RideSettings::useLookAhead)
+        .def_readwrite("look_ahead_samples", &RideSettings::lookAheadSamples)
+        .def("__repr__", [](const RideSettings& s)
+        {
+            return "<magicride.Settings target_db=" + std::to_string(s.targetDb)
+                 + " speed=" + std::to_string(s.speed)
+                 + (s.naturalMode ? " natural>" : " standard>");
+        });
+
+    py::class_<RideStageAnalyzer>(m, "Analyzer",
+                                  "Streaming ride analysis; state carries over between process() calls. "
+                                  "Use one Analyzer per thread.")
+        .def(py::init<double, const RideSettings&>(), "sample_rate"_a, "settings"_a = RideSettings())
+        .def("process", &runAnalyzer, "audio"_a.noconvert(), "channel_axis"_a = 0,
+             "Analyses the next block of float32 audio, (samples,) or 2-D with channels on channel_axis. "
+             "Returns a dict of per-sample stage arrays.")
+        .def("reset", &RideStageAnalyzer::reset)
+        .def_property_readonly("sample_rate", &RideStageAnalyzer::getSampleRate)
+        .def_property_readonly("settings", [](const RideStageAnalyzer& a) { return a.getSettings(); });
+
+    m.def("analyze",
+          [](const AudioArray& audio, double sampleRate, const RideSettings& settings, int channelAxis)
+          {
+              RideStageAnalyzer analyzer(sampleRate, settings);
+              return runAnalyzer(analyzer, audio, channelAxis);
+          },
+          "audio"_a.noconvert(), "sample_rate"_a, "settings"_a = RideSettings(), "channel_axis"_a = 0,
+          "Rides a whole file from a clean state and returns a dict of per-sample stage arrays: "
+          "rms_db, peak_db, peak_ahead_db, gate_open, in_phrase, target_gain_db, gain_db.");
+}
@@ -0,0 +1,441 @@
+/*
+  ==============================================================================
+
+    SoakMain.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+    Long-duration soak harness. Runs the detector, both ride modes and the
+    waveform display's data path over a day (by default) of generated audio,
+    as fast as the machine allows, and every report interval records:
+
+      - RMS detector error against a double-precision sliding window
+      - Engine output at a fixed calibration tone (LUFS, RMS, both gains),
+        which must match the first calibration
+      - Resident memory and the waveform column queue
+      - Block processing time percentiles
+
+    Exits non-zero on non-finite output, drift beyond tolerance, sustained
+    growth of memory or the queue, or block times creeping up.
+
+      VocalRiderSoak --hours 24 --report-minutes 10 --csv soak.csv
+
+  ==============================================================================
+*/
+
+#include <juce_core/juce_core.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "DSP/RideDetector.h"
+#include "DSP/RideCore.h"
+#include "DSP/RideSettings.h"
+#include "UI/WaveformDisplay.h"
+#include "SoakSignal.h"
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#elif JUCE_WINDOWS
+ #include <windows.h>
+ #include <psapi.h>
+#endif
+
+namespace
+{
+    //==============================================================================
+    struct Options
+    {
+        double hours = 24.0;
+        double sampleRate = 48000.0;
+        int blockSize = 512;
+        double reportMinutes = 10.0;
+        float speed = 50.0f;
+        juce::int64 seed = 1;
+        bool withDisplay = true;
+        bool checkTiming = true;
+
+        double rmsToleranceDb = 0.25;           // Detector vs double reference (signal above -60 dB)
+        double calibrationToleranceDb = 0.1;    // Calibration readings vs the first one
+        double memoryToleranceMb = 8.0;         // Resident growth after warm-up
+        double timingTolerance = 4.0;           // p99 block time vs the first measured interval
+        int warmUpReports = 2;
+
+        juce::File csvFile;
+    };
+
+    Options parseOptions(const juce::ArgumentList& args)
+    {
+        Options o;
+        auto number = [&args](const char* option, double fallback)
+        {
+            return args.containsOption(option) ? args.getValueForOption(option).getDoubleValue() : fallback;
+        };
+
+        o.hours = number("--hours", o.hours);
+        o.sampleRate = number("--sample-rate", o.sampleRate);
+        o.blockSize = static_cast<int>(number("--block", o.blockSize));
+        o.reportMinutes = number("--report-minutes", o.reportMinutes);
+        o.speed = static_cast<float>(number("--speed", o.speed));
+        o.seed = static_cast<juce::int64>(number("--seed", static_cast<double>(o.seed)));
+        o.rmsToleranceDb = number("--rms-tolerance", o.rmsToleranceDb);
+        o.calibrationToleranceDb = number("--calibration-tolerance", o.calibrationToleranceDb);
+        o.memoryToleranceMb = number("--memory-tolerance", o.memoryToleranceMb);
+        o.timingTolerance = number("--timing-tolerance", o.timingTolerance);
+        o.withDisplay = !args.containsOption("--no-display");
+        o.checkTiming = !args.containsOption("--no-timing-check");
+
+        if (args.containsOption("--csv"))
+            o.csvFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--csv"));
+
+        o.sampleRate = juce::jlimit(8000.0, 384000.0, o.sampleRate);
+        o.blockSize = juce::jlimit(16, 8192, o.blockSize);
+        o.reportMinutes = juce::jmax(1.0, o.reportMinutes);
+        return o;
+    }
+
+    //==============================================================================
+    double getResidentMegabytes()
+    {
+       #if JUCE_LINUX
+        if (auto* f = std::fopen("/proc/self/statm", "r"))
+        {
+            long totalPages = 0, residentPages = 0;
+            const bool ok = std::fscanf(f, "%ld %ld", &totalPages, &residentPages) == 2;
+            std::fclose(f);
+            if (ok)
+                return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+        }
+       #elif JUCE_MAC
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+            return static_cast<double>(info.resident_size) / (1024.0 * 1024.0);
+       #elif JUCE_WINDOWS
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return static_cast<double>(counters.WorkingSetSize) / (1024.0 * 1024.0);
+       #endif
+        return 0.0;
+    }
+
+    /** Same sliding window as RMSDetector, in double, recomputed exactly every wrap */
+    class ReferenceRms
+    {
+    public:
+        ReferenceRms(double sampleRate, float speed)
+        {
+            const float windowMs = juce::jmap(speed, 0.0f, 100.0f, 100.0f, 10.0f);
+            windowSize = juce::jmax(1, static_cast<int>((windowMs / 1000.0f) * sampleRate));
+            window.assign(static_cast<size_t>(windowSize), 0.0);
+        }
+
+        double processSample(float x)
+        {
+            const double squared = static_cast<double>(x) * x;
+            sum += squared - window[static_cast<size_t>(index)];
+            window[static_cast<size_t>(index)] = squared;
+
+            if (++index == windowSize)
+            {
+                index = 0;
+                sum = 0.0;
+                for (double v : window)
+                    sum += v;
+            }
+
+            const double meanSquare = sum / windowSize;
+            return meanSquare > 1.0e-10 ? 10.0 * std::log10(meanSquare) : -100.0;
+        }
+
+    private:
+        std::vector<double> window;
+        int windowSize = 1;
+        int index = 0;
+        double sum = 0.0;
+    };
+
+    struct Calibration
+    {
+        double rmsDb = 0.0, lufs = 0.0, naturalGainDb = 0.0, standardGainDb = 0.0;
+    };
+
+    struct Report
+    {
+        double hours = 0.0;
+        double maxRmsErrorDb = 0.0;
+        double calibrationDriftDb = 0.0;
+        double residentMb = 0.0;
+        int queueSize = 0, queueCapacity = 0;
+        double p50Us = 0.0, p99Us = 0.0, p999Us = 0.0, maxUs = 0.0;
+        double realtimeFactor = 0.0;
+    };
+
+    double percentile(std::vector<float>& sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        const auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+        return sorted[index];
+    }
+
+    /** True if the series only ever rises over enough reports and by more than noise */
+    bool growsMonotonically(const std::vector<double>& series, double minimumGrowth)
+    {
+        if (series.size() < 6)
+            return false;
+        for (size_t i = 1; i < series.size(); ++i)
+            if (series[i] < series[i - 1])
+                return false;
+        return series.back() - series.front() > minimumGrowth;
+    }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+    const auto options = parseOptions(args);
+
+    // The display is a Component, so its data path needs a message manager
+    std::unique_ptr<juce::ScopedJuceInitialiser_GUI> gui;
+    std::unique_ptr<WaveformDisplay> display;
+    if (options.withDisplay)
+    {
+        gui = std::make_unique<juce::ScopedJuceInitialiser_GUI>();
+        display = std::make_unique<WaveformDisplay>();
+        display->setSize(800, 240);
+        display->stopTimer();   // Driven below on simulated time
+    }
+
+    // Engine under test: one detector feeding both ride modes (LUFS and breath on
+    // so their block integrators run too)
+    RideSettings detectorSettings;
+    detectorSettings.speed = options.speed;
+    detectorSettings.useLufs = true;
+    detectorSettings.breathReductionDb = 3.0f;
+
+    RideSettings naturalSettings = detectorSettings;
+    naturalSettings.naturalMode = true;
+    RideSettings standardSettings = detectorSettings;
+    standardSettings.naturalMode = false;
+
+    RideDetector detector;
+    RideCore naturalCore, standardCore;
+    detector.prepare(options.sampleRate, options.blockSize, options.speed);
+    naturalCore.prepare(options.sampleRate);
+    standardCore.prepare(options.sampleRate);
+    naturalCore.setSettings(naturalSettings);
+    standardCore.setSettings(standardSettings);
+
+    SoakSignal signal(options.sampleRate, options.seed);
+    ReferenceRms reference(options.sampleRate, options.speed);
+
+    const auto blockSize = static_cast<size_t>(options.blockSize);
+    std::vector<float> input(blockSize), output(blockSize), naturalGain(blockSize), standardGain(blockSize);
+
+    const auto totalSamples = static_cast<juce::int64>(options.hours * 3600.0 * options.sampleRate);
+    const auto reportSamples = static_cast<juce::int64>(options.reportMinutes * 60.0 * options.sampleRate);
+    const auto displayFrameSamples = static_cast<juce::int64>(options.sampleRate / 30.0);
+    const auto expectedBlocks = static_cast<size_t>(reportSamples / options.blockSize + 1);
+
+    std::vector<float> blockMicros;
+    blockMicros.reserve(expectedBlocks);
+
+    std::unique_ptr<juce::FileOutputStream> csv;
+    if (options.csvFile != juce::File())
+    {
+        options.csvFile.deleteFile();
+        csv = std::make_unique<juce::FileOutputStream>(options.csvFile);
+        if (csv->openedOk())
+            *csv << "hours,max_rms_error_db,calibration_drift_db,resident_mb,queue_size,queue_capacity,"
+                    "p50_us,p99_us,p999_us,max_us,realtime_factor\n";
+    }
+
+    std::cout << "magic.RIDE soak: " << options.hours << " h at " << options.sampleRate << " Hz, "
+              << options.blockSize << "-sample blocks, report every " << options.reportMinutes << " min"
+              << (options.withDisplay ? "" : " (no display)") << std::endl;
+
+    juce::StringArray failures;
+    std::vector<Report> reports;
+    std::vector<Calibration> calibrations;
+    double intervalMaxRmsError = 0.0, maxCalibrationDrift = 0.0;
+
+    juce::int64 processed = 0, nextReport = reportSamples, nextDisplayFrame = displayFrameSamples;
+    auto intervalStartTicks = juce::Time::getHighResolutionTicks();
+    signal.requestCalibration();
+
+    while (processed < totalSamples && failures.isEmpty())
+    {
+        // Stop blocks at the calibration point so it is read at the same sample every time
+        const int numSamples = static_cast<int>(juce::jmin<juce::int64>(options.blockSize,
+                                                                       signal.getSamplesToCalibrationPoint(),
+                                                                       totalSamples - processed));
+        signal.generate(input.data(), numSamples);
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        detector.process(input.data(), numSamples, detectorSettings);
+        naturalCore.processBlock(detector, numSamples, naturalGain.data());
+        standardCore.processBlock(detector, numSamples, standardGain.data());
+
+        for (int i = 0; i < numSamples; ++i)
+            output[static_cast<size_t>(i)] = input[static_cast<size_t>(i)]
+                                           * juce::Decibels::decibelsToGain(naturalGain[static_cast<size_t>(i)]);
+
+        if (display != nullptr)
+            display->pushSamples(input.data(), output.data(), naturalGain.data(), numSamples);
+
+        blockMicros.push_back(static_cast<float>(1.0e6 * juce::Time::highResolutionTicksToSeconds(
+                                  juce::Time::getHighResolutionTicks() - start)));
+
+        // Checks (outside the timed region)
+        const float* filtered = detector.getFilteredSamples();
+        const float* rmsDb = detector.getRmsDb();
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double referenceDb = reference.processSample(filtered[i]);
+            if (referenceDb > -60.0)
+                intervalMaxRmsError = juce::jmax(intervalMaxRmsError, std::abs(static_cast<double>(rmsDb[i]) - referenceDb));
+
+            if (!std::isfinite(naturalGain[static_cast<size_t>(i)]) || !std::isfinite(standardGain[static_cast<size_t>(i)]))
+            {
+                failures.add("Non-finite gain at " + juce::String(static_cast<double>(processed + i) / options.sampleRate / 3600.0, 3) + " h");
+                break;
+            }
+        }
+
+        processed += numSamples;
+
+        if (signal.takeCalibrationPoint())
+        {
+            Calibration c { rmsDb[numSamples - 1], detector.getLufs(),
+                            naturalCore.getCurrentGainDb(), standardCore.getCurrentGainDb() };
+
+            if (!calibrations.empty())
+            {
+                const auto& first = calibrations.front();
+                const double drift = std::max({ std::abs(c.rmsDb - first.rmsDb), std::abs(c.lufs - first.lufs),
+                                                std::abs(c.naturalGainDb - first.naturalGainDb),
+                                                std::abs(c.standardGainDb - first.standardGainDb) });
+                maxCalibrationDrift = juce::jmax(maxCalibrationDrift, drift);
+            }
+            calibrations.push_back(c);
+        }
+
+        // Display timer on simulated time: consumes far less than is pushed, like a
+        // stalled message thread, which is the case its queue has to survive
+        if (display != nullptr && processed >= nextDisplayFrame)
+        {
+            nextDisplayFrame += displayFrameSamples;
+            display->timerCallback();
+        }
+
+        if (processed >= nextReport || processed >= totalSamples)
+        {
+            nextReport += reportSamples;
+
+            const auto now = juce::Time::getHighResolutionTicks();
+            const double wallSeconds = juce::Time::highResolutionTicksToSeconds(now - intervalStartTicks);
+            intervalStartTicks = now;
+
+            std::sort(blockMicros.begin(), blockMicros.end());
+
+            Report r;
+            r.hours = static_cast<double>(processed) / options.sampleRate / 3600.0;
+            r.maxRmsErrorDb = intervalMaxRmsError;
+            r.calibrationDriftDb = maxCalibrationDrift;
+            r.residentMb = getResidentMegabytes();
+            if (display != nullptr)
+                std::tie(r.queueSize, r.queueCapacity) = display->getPendingQueueSize();
+            r.p50Us = percentile(blockMicros, 0.5);
+            r.p99Us = percentile(blockMicros, 0.99);
+            r.p999Us = percentile(blockMicros, 0.999);
+            r.maxUs = blockMicros.empty() ? 0.0 : blockMicros.back();
+            r.realtimeFactor = wallSeconds > 0.0 ? options.reportMinutes * 60.0 / wallSeconds : 0.0;
+            reports.push_back(r);
+
+            const auto line = juce::String(r.hours, 2) + " h  rms err " + juce::String(r.maxRmsErrorDb, 4)
+                            + " dB  cal drift " + juce::String(r.calibrationDriftDb, 4)
+                            + " dB  rss " + juce::String(r.residentMb, 1)
+                            + " MB  queue " + juce::String(r.queueSize) + "/" + juce::String(r.queueCapacity)
+                            + "  block p50 " + juce::String(r.p50Us, 1) + " p99 " + juce::String(r.p99Us, 1)
+                            + " p99.9 " + juce::String(r.p999Us, 1) + " max " + juce::String(r.maxUs, 1)
+                            + " us  " + juce::String(r.realtimeFactor, 0) + "x";
+            std::cout << line << std::endl;
+
+            if (csv != nullptr && csv->openedOk())
+            {
+                *csv << juce::String(r.hours, 4) << "," << juce::String(r.maxRmsErrorDb, 6) << ","
+                     << juce::String(r.calibrationDriftDb, 6) << "," << juce::String(r.residentMb, 2) << ","
+                     << r.queueSize << "," << r.queueCapacity << "," << juce::String(r.p50Us, 2) << ","
+                     << juce::String(r.p99Us, 2) << "," << juce::String(r.p999Us, 2) << ","
+                     << juce::String(r.maxUs, 2) << "," << juce::String(r.realtimeFactor, 1) << "\n";
+                csv->flush();
+            }
+
+            // Drift fails as soon as it shows
+            if (r.maxRmsErrorDb > options.rmsToleranceDb)
+                failures.add("RMS detector error " + juce::String(r.maxRmsErrorDb, 4) + " dB exceeds "
+                             + juce::String(options.rmsToleranceDb) + " dB");
+            if (r.calibrationDriftDb > options.calibrationToleranceDb)
+                failures.add("Calibration drift " + juce::String(r.calibrationDriftDb, 4) + " dB exceeds "
+                             + juce::String(options.calibrationToleranceDb) + " dB");
+
+            intervalMaxRmsError = 0.0;
+            blockMicros.clear();
+            signal.requestCalibration();
+        }
+    }
+
+    //==============================================================================
+    // Growth and timing, after warm-up (caches, lazily allocated buffers)
+    std::vector<double> resident, queue;
+    const Report* timingBaseline = nullptr;
+    for (size_t i = static_cast<size_t>(options.warmUpReports); i < reports.size(); ++i)
+    {
+        const auto& r = reports[i];
+        resident.push_back(r.residentMb);
+        queue.push_back(static_cast<double>(r.queueCapacity));
+
+        if (timingBaseline == nullptr)
+            timingBaseline = &r;
+        else if (options.checkTiming && r.p99Us > options.timingTolerance * timingBaseline->p99Us)
+            failures.add("Block time p99 " + juce::String(r.p99Us, 1) + " us at " + juce::String(r.hours, 2)
+                         + " h is over " + juce::String(options.timingTolerance) + "x the first interval");
+    }
+
+    if (!resident.empty())
+    {
+        const double growth = resident.back() - *std::min_element(resident.begin(), resident.end());
+        if (growth > options.memoryToleranceMb)
+            failures.add("Resident memory grew " + juce::String(growth, 1) + " MB after warm-up");
+        if (growsMonotonically(resident, 0.25))
+            failures.add("Resident memory grew in every report after warm-up");
+    }
+
+    if (display != nullptr && !queue.empty())
+    {
+        const double initialCapacity = static_cast<double>(reports.front().queueCapacity);
+        if (*std::max_element(queue.begin(), queue.end()) > initialCapacity)
+            failures.add("Waveform queue outgrew its reserved capacity");
+        if (growsMonotonically(queue, 0.0))
+            failures.add("Waveform queue capacity grew in every report after warm-up");
+    }
+
+    if (failures.isEmpty())
+    {
+        std::cout << "PASS after " << juce::String(static_cast<double>(processed) / options.sampleRate / 3600.0, 2) << " h" << std::endl;
+        return 0;
+    }
+
+    for (const auto& failure : failures)
+        std::cout << "FAIL: " << failure << std::endl;
+    return 1;
+}
@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+    SoakSignal.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "SoakSignal.h"
+#include <cmath>
+
+namespace
+{
+    constexpr double twoPi = juce::MathConstants<double>::twoPi;
+
+    double wrap(double phase) { return phase - std::floor(phase); }
+}
+
+SoakSignal::SoakSignal(double sr, juce::int64 seed)
+    : sampleRate(sr), random(seed)
+{
+    noiseFloorGain = juce::Decibels::decibelsToGain(-75.0f);
+    startNextSegment();
+}
+
+//==============================================================================
+int SoakSignal::getSamplesToCalibrationPoint() const
+{
+    if (segment != Segment::CalibrationTone || segmentPosition >= segmentLength)
+        return std::numeric_limits<int>::max();
+
+    return static_cast<int>(segmentLength - segmentPosition);
+}
+
+bool SoakSignal::takeCalibrationPoint()
+{
+    const bool reached = calibrationPointReached;
+    calibrationPointReached = false;
+    return reached;
+}
+
+void SoakSignal::generate(float* dest, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (segmentPosition >= segmentLength)
+            startNextSegment();
+
+        float sample = 0.0f;
+        switch (segment)
+        {
+            case Segment::Phrase:
+            case Segment::Sustain:
+                sample = nextVoiceSample();
+                break;
+
+            case Segment::CalibrationTone:
+                sample = juce::Decibels::decibelsToGain(calibrationLevelDb) * juce::MathConstants<float>::sqrt2
+                       * static_cast<float>(std::sin(twoPi * calibrationPhase));
+                calibrationPhase = wrap(calibrationPhase + calibrationHz / sampleRate);
+                break;
+
+            case Segment::Silence:
+                sample = noiseFloorGain * (random.nextFloat() * 2.0f - 1.0f);
+                break;
+
+            case Segment::CalibrationSilence:
+                break;  // Digital silence: the calibration is the same every time
+        }
+
+        dest[i] = sample;
+        ++segmentPosition;
+        ++samplesSinceSustain;
+
+        if (segment == Segment::CalibrationTone && segmentPosition == segmentLength)
+            calibrationPointReached = true;
+    }
+}
+
+//==============================================================================
+void SoakSignal::startNextSegment()
+{
+    const auto previous = segment;
+    segmentPosition = 0;
+
+    if (previous == Segment::CalibrationSilence)
+    {
+        segment = Segment::CalibrationTone;
+        segmentLength = secondsToSamples(calibrationToneSeconds);
+        calibrationPhase = 0.0;
+        return;
+    }
+
+    if (calibrationRequested)
+    {
+        calibrationRequested = false;
+        segment = Segment::CalibrationSilence;
+        segmentLength = secondsToSamples(calibrationSilenceSeconds);
+        return;
+    }
+
+    if (samplesSinceSustain >= secondsToSamples(sustainIntervalSeconds))
+    {
+        // Minutes of input without a gap (drone, sustained pad) - phrases never end
+        samplesSinceSustain = 0;
+        segment = Segment::Sustain;
+        startVoice(120.0, 900.0);
+        return;
+    }
+
+    if (previous == Segment::Phrase && random.nextFloat() < 0.7f)
+    {
+        segment = Segment::Silence;
+        segmentLength = secondsToSamples(0.1 + random.nextDouble() * 2.9);
+        return;
+    }
+
+    // New phrase (after a gap, or straight on at a new level)
+    segment = Segment::Phrase;
+    startVoice(0.4, 6.0);
+}
+
+void SoakSignal::startVoice(double minSeconds, double maxSeconds)
+{
+    segmentLength = secondsToSamples(minSeconds + random.nextDouble() * (maxSeconds - minSeconds));
+    fundamentalHz = 90.0 + random.nextDouble() * 230.0;
+    syllableHz = 2.0 + random.nextDouble() * 4.0;
+    syllableDepth = random.nextFloat() * 0.6f;
+    voiceGain = juce::Decibels::decibelsToGain(-42.0f + random.nextFloat() * 34.0f);
+}
+
+float SoakSignal::nextVoiceSample()
+{
+    // 50 ms raised-cosine fades at the segment edges
+    const auto fadeSamples = secondsToSamples(0.05);
+    const auto edge = juce::jmin(segmentPosition, segmentLength - 1 - segmentPosition);
+    const float fade = edge < fadeSamples
+                     ? 0.5f - 0.5f * static_cast<float>(std::cos(juce::MathConstants<double>::pi * edge / fadeSamples))
+                     : 1.0f;
+
+    const float syllable = 1.0f - syllableDepth * 0.5f * (1.0f + static_cast<float>(std::sin(twoPi * syllablePhase)));
+
+    // Six harmonics at 1/k, plus a little breath noise
+    float voice = 0.0f;
+    for (int k = 1; k <= 6; ++k)
+        voice += static_cast<float>(std::sin(twoPi * wrap(voicePhase * k))) / static_cast<float>(k);
+    voice = voice * 0.55f + 0.05f * (random.nextFloat() * 2.0f - 1.0f);
+
+    // 5 Hz vibrato, +-1.5 %
+    const double vibrato = 1.0 + 0.015 * std::sin(twoPi * vibratoPhase);
+    voicePhase = wrap(voicePhase + fundamentalHz * vibrato / sampleRate);
+    vibratoPhase = wrap(vibratoPhase + 5.0 / sampleRate);
+    syllablePhase = wrap(syllablePhase + syllableHz / sampleRate);
+
+    return voice * voiceGain * syllable * fade;
+}
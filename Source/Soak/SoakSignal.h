@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    SoakSignal.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Deterministic vocal-like test signal for the soak harness: sung phrases
+    (harmonic voice with vibrato and syllable modulation) separated by
+    near-silent gaps, an occasional long sustained section, and calibration
+    segments on request. A calibration segment is always the same samples
+    (silence, then a fixed sine from phase zero), so whatever the engine
+    reports at its end should not change over the run.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <limits>
+
+class SoakSignal
+{
+public:
+    SoakSignal(double sampleRate, juce::int64 seed);
+
+    /** Fills the next numSamples samples */
+    void generate(float* dest, int numSamples);
+
+    /** Starts a calibration segment once the current segment ends */
+    void requestCalibration() { calibrationRequested = true; }
+
+    /** Samples left until the end of the calibration tone (blocks should stop there) */
+    int getSamplesToCalibrationPoint() const;
+
+    /** True once, right after the last sample of a calibration tone was generated */
+    bool takeCalibrationPoint();
+
+    static constexpr float calibrationLevelDb = -20.0f;
+    static constexpr double calibrationHz = 1000.0;
+    static constexpr double calibrationSilenceSeconds = 5.0;
+    static constexpr double calibrationToneSeconds = 10.0;
+    static constexpr double sustainIntervalSeconds = 3600.0;
+
+private:
+    //==============================================================================
+    enum class Segment { Phrase, Silence, Sustain, CalibrationSilence, CalibrationTone };
+
+    void startNextSegment();
+    void startVoice(double minSeconds, double maxSeconds);
+    float nextVoiceSample();
+    juce::int64 secondsToSamples(double seconds) const { return static_cast<juce::int64>(seconds * sampleRate); }
+
+    //==============================================================================
+    const double sampleRate;
+    juce::Random random;
+
+    Segment segment = Segment::Silence;
+    juce::int64 segmentLength = 0;
+    juce::int64 segmentPosition = 0;
+    juce::int64 samplesSinceSustain = 0;
+
+    // Voice (phases kept in cycles and wrapped, so long runs don't lose precision)
+    double fundamentalHz = 200.0;
+    double voicePhase = 0.0;
+    double vibratoPhase = 0.0;
+    double syllablePhase = 0.0;
+    double syllableHz = 4.0;
+    float syllableDepth = 0.0f;
+    float voiceGain = 0.0f;
+    float noiseFloorGain = 0.0f;
+
+    double calibrationPhase = 0.0;
+    bool calibrationRequested = false;
+    bool calibrationPointReached = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SoakSignal)
+};
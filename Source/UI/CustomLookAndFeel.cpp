@@ -160,98 +160,10 @@ void CustomLookAndFeel::drawLargeKnob(juce::Graphics& g, juce::Rectangle<float>
                                        float rotaryEndAngle, juce::Colour accentColour,
                                        bool isHovered)
 {
-    auto centreX = bounds.getCentreX();
-    auto centreY = bounds.getCentreY();
-    auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f * 0.92f;
-    
-    float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
-    
-    auto outerRadius = radius;
-    auto knobRadius = outerRadius * 0.82f;  // Bigger inner knob (was 0.72)
-    float arcRadius = (outerRadius + knobRadius) / 2.0f;
-    float arcThickness = (outerRadius - knobRadius) * 0.85f;  // Thinner arc
-    
-    // FULLY OPAQUE circular background that covers the entire knob area
-    g.setColour(juce::Colour(0xFF0D0E11));
-    g.fillEllipse(centreX - outerRadius, centreY - outerRadius, 
-                  outerRadius * 2.0f, outerRadius * 2.0f);
-    
-    // Outer ring - thinner grey ring (brighter on hover)
-    g.setColour(isHovered ? juce::Colour(0xFF4A4D55) : juce::Colour(0xFF3A3D45));
-    g.drawEllipse(centreX - outerRadius, centreY - outerRadius, 
-                  outerRadius * 2.0f, outerRadius * 2.0f, 1.0f);
-    
-    // Main knob body with gradient (darker top, lighter bottom)
-    auto knobBounds = juce::Rectangle<float>(
-        centreX - knobRadius, centreY - knobRadius,
-        knobRadius * 2.0f, knobRadius * 2.0f
-    );
-    
-    // Arc groove background (thinner ring between outer and inner)
-    juce::Path backgroundArc;
-    backgroundArc.addCentredArc(centreX, centreY, arcRadius, arcRadius, 
-                                 0.0f, rotaryStartAngle, rotaryEndAngle, true);
-    g.setColour(juce::Colour(0xFF151619));
-    g.strokePath(backgroundArc, juce::PathStrokeType(arcThickness, 
-                 juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    
-    // Create gradient: darker grey at top, lighter grey at bottom
-    juce::ColourGradient knobGradient(
-        juce::Colour(0xFF1E2028),
-        centreX, centreY - knobRadius,
-        juce::Colour(0xFF353840),
-        centreX, centreY + knobRadius,
-        false
-    );
-    
-    // Fill with gradient
-    juce::Path knobPath;
-    knobPath.addEllipse(knobBounds);
-    g.setGradientFill(knobGradient);
-    g.fillPath(knobPath);
-    
-    // Hover glow effect
-    if (isHovered)
-    {
-        g.setColour(accentColour.withAlpha(0.06f));
-        g.fillEllipse(knobBounds.expanded(2.0f));
-    }
-    
-    // Draw value arc with gradient
-    if (sliderPosProportional > 0.001f)
-    {
-        juce::Path valueArc;
-        valueArc.addCentredArc(centreX, centreY, arcRadius, arcRadius, 
-                               0.0f, rotaryStartAngle, angle, true);
-        
-        // Purple gradient for the value arc
-        juce::ColourGradient arcGradient(
-            accentColour.darker(0.3f),
-            centreX + std::sin(rotaryStartAngle) * arcRadius,
-            centreY - std::cos(rotaryStartAngle) * arcRadius,
-            accentColour.brighter(0.1f),
-            centreX + std::sin(angle) * arcRadius,
-            centreY - std::cos(angle) * arcRadius,
-            false
-        );
-        
-        g.setGradientFill(arcGradient);
-        g.strokePath(valueArc, juce::PathStrokeType(arcThickness * 0.75f,  // Thinner arc
-                     juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    }
-    
-    // Position indicator LINE - THINNER line from center toward edge
-    auto lineStartDist = knobRadius * 0.2f;
-    auto lineEndDist = knobRadius * 0.8f;
-    
-    auto lineStartX = centreX + std::sin(angle) * lineStartDist;
-    auto lineStartY = centreY - std::cos(angle) * lineStartDist;
-    auto lineEndX = centreX + std::sin(angle) * lineEndDist;
-    auto lineEndY = centreY - std::cos(angle) * lineEndDist;
-    
-    // Subtle indicator line
-    g.setColour(accentColour.withAlpha(0.85f));
-    g.drawLine(lineStartX, lineStartY, lineEndX, lineEndY, 1.2f);
+    // Shares the look-and-feel's cache, so this is only a reference count
+    juce::SharedResourcePointer<KnobFilmstripCache> cache;
+    drawKnob(g, *cache, bounds, sliderPosProportional, rotaryStartAngle, rotaryEndAngle,
+             accentColour, KnobType::Large, isHovered, false);
 }
 
 //==============================================================================
@@ -262,18 +174,73 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int wi
                                           float rotaryEndAngle, juce::Slider& slider)
 {
     auto bounds = juce::Rectangle<int>(x, y, width, height).toFloat();
-    auto centreX = bounds.getCentreX();
-    auto centreY = bounds.getCentreY();
-    auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f * 0.92f;
-    
-    float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
     bool isDisabled = !slider.isEnabled();
     auto accentColour = isDisabled ? juce::Colour(0xFF3A3D48) : getAccentColour();
     
     // Check if mouse is over for hover effect
     bool isHovered = !isDisabled && slider.isMouseOver();
     
-    auto outerRadius = radius;
+    drawKnob(g, *knobFilmstrips, bounds, sliderPosProportional, rotaryStartAngle, rotaryEndAngle,
+             accentColour, KnobType::Rotary, isHovered, isDisabled);
+}
+
+//==============================================================================
+// Knob layers
+
+void CustomLookAndFeel::drawKnob(juce::Graphics& g, KnobFilmstripCache& cache, juce::Rectangle<float> bounds,
+                                  float sliderPosProportional, float rotaryStartAngle, float rotaryEndAngle,
+                                  juce::Colour accentColour, KnobType type, bool isHovered, bool isDisabled)
+{
+    auto side = juce::jmin(bounds.getWidth(), bounds.getHeight());
+    auto area = bounds.withSizeKeepingCentre(side, side);
+    float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
+    
+    // The large knob never dims its indicator
+    auto indicatorColour = accentColour.withAlpha(isDisabled && type == KnobType::Rotary ? 0.5f : 0.85f);
+    
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto key = KnobFilmstripCache::makeKey(type == KnobType::Large ? KnobFilmstripCache::largeKnobStyle
+                                                                             : KnobFilmstripCache::rotaryKnobStyle,
+                                                 isDisabled ? 1 : 0,
+                                                 area, pixelScale, accentColour, rotaryStartAngle, rotaryEndAngle);
+    
+    if (auto strip = cache.find(key))
+    {
+        // Body and indicator at the nearest quantised angle in one blit
+        strip->draw(g, area, sliderPosProportional);
+    }
+    else
+    {
+        // Indicator tip sits at 0.8 x the knob body radius
+        auto tipRadius = side / 2.0f * 0.92f * 0.82f * 0.8f;
+        cache.request(key, KnobFilmstripCache::getFramesForTravel(tipRadius, rotaryStartAngle, rotaryEndAngle, pixelScale),
+                      [=](juce::Graphics& sg, juce::Rectangle<float> stripArea)
+                      {
+                          drawKnobBody(sg, stripArea, rotaryStartAngle, rotaryEndAngle);
+                      },
+                      [=](juce::Graphics& sg, juce::Rectangle<float> stripArea, float frameAngle)
+                      {
+                          drawKnobIndicator(sg, stripArea, frameAngle, indicatorColour);
+                      });
+        
+        drawKnobBody(g, area, rotaryStartAngle, rotaryEndAngle);
+        drawKnobIndicator(g, area, angle, indicatorColour);
+    }
+    
+    if (isHovered)
+        drawKnobHover(g, area, accentColour, type);
+    
+    // The value arc is always drawn at the exact position
+    if (sliderPosProportional > 0.001f)
+        drawKnobValueArc(g, area, rotaryStartAngle, angle, accentColour, type);
+}
+
+void CustomLookAndFeel::drawKnobBody(juce::Graphics& g, juce::Rectangle<float> area,
+                                      float rotaryStartAngle, float rotaryEndAngle)
+{
+    auto centreX = area.getCentreX();
+    auto centreY = area.getCentreY();
+    auto outerRadius = area.getWidth() / 2.0f * 0.92f;
     auto knobRadius = outerRadius * 0.82f;  // Bigger inner knob (was 0.72)
     float arcRadius = (outerRadius + knobRadius) / 2.0f;
     float arcThickness = (outerRadius - knobRadius) * 0.85f;  // Thinner arc
@@ -284,8 +251,8 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int wi
     g.fillEllipse(centreX - outerRadius, centreY - outerRadius, 
                   outerRadius * 2.0f, outerRadius * 2.0f);
     
-    // Outer ring - thinner grey ring (brighter on hover)
-    g.setColour(isHovered ? juce::Colour(0xFF4A4D55) : juce::Colour(0xFF3A3D45));
+    // Outer ring - thinner grey ring (brighter on hover, see drawKnobHover)
+    g.setColour(juce::Colour(0xFF3A3D45));
     g.drawEllipse(centreX - outerRadius, centreY - outerRadius, 
                   outerRadius * 2.0f, outerRadius * 2.0f, 1.0f);
     
@@ -317,36 +284,35 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int wi
     knobPath.addEllipse(knobBounds);
     g.setGradientFill(knobGradient);
     g.fillPath(knobPath);
+}
+
+void CustomLookAndFeel::drawKnobHover(juce::Graphics& g, juce::Rectangle<float> area,
+                                       juce::Colour accentColour, KnobType type)
+{
+    auto centreX = area.getCentreX();
+    auto centreY = area.getCentreY();
+    auto outerRadius = area.getWidth() / 2.0f * 0.92f;
+    auto knobRadius = outerRadius * 0.82f;
     
-    // Hover glow effect
-    if (isHovered)
-    {
-        g.setColour(accentColour.withAlpha(0.1f));
-        g.fillEllipse(knobBounds.expanded(3.0f));
-    }
+    // Brighter outer ring over the body's
+    g.setColour(juce::Colour(0xFF4A4D55));
+    g.drawEllipse(centreX - outerRadius, centreY - outerRadius, 
+                  outerRadius * 2.0f, outerRadius * 2.0f, 1.0f);
     
-    // Draw value arc with gradient (darker purple to lighter purple)
-    if (sliderPosProportional > 0.001f)
-    {
-        juce::Path valueArc;
-        valueArc.addCentredArc(centreX, centreY, arcRadius, arcRadius, 
-                               0.0f, rotaryStartAngle, angle, true);
-        
-        // Create purple gradient for the value arc
-        juce::ColourGradient arcGradient(
-            accentColour.darker(0.3f),  // Darker purple at start
-            centreX + std::sin(rotaryStartAngle) * arcRadius,
-            centreY - std::cos(rotaryStartAngle) * arcRadius,
-            accentColour.brighter(0.1f),  // Lighter purple at end
-            centreX + std::sin(angle) * arcRadius,
-            centreY - std::cos(angle) * arcRadius,
-            false
-        );
-        
-        g.setGradientFill(arcGradient);
-        g.strokePath(valueArc, juce::PathStrokeType(arcThickness * 0.85f, 
-                     juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    }
+    // Hover glow effect (softer on the large knob)
+    bool isLarge = type == KnobType::Large;
+    g.setColour(accentColour.withAlpha(isLarge ? 0.06f : 0.1f));
+    g.fillEllipse(juce::Rectangle<float>(centreX - knobRadius, centreY - knobRadius,
+                                         knobRadius * 2.0f, knobRadius * 2.0f)
+                      .expanded(isLarge ? 2.0f : 3.0f));
+}
+
+void CustomLookAndFeel::drawKnobIndicator(juce::Graphics& g, juce::Rectangle<float> area, float angle,
+                                           juce::Colour indicatorColour)
+{
+    auto centreX = area.getCentreX();
+    auto centreY = area.getCentreY();
+    auto knobRadius = area.getWidth() / 2.0f * 0.92f * 0.82f;
     
     // Position indicator LINE - THINNER line from center toward edge
     auto lineStartDist = knobRadius * 0.2f;
@@ -357,10 +323,42 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int wi
     auto lineEndX = centreX + std::sin(angle) * lineEndDist;
     auto lineEndY = centreY - std::cos(angle) * lineEndDist;
     
-    g.setColour(accentColour.withAlpha(isDisabled ? 0.5f : 0.85f));
+    g.setColour(indicatorColour);
     g.drawLine(lineStartX, lineStartY, lineEndX, lineEndY, 1.2f);
 }
 
+void CustomLookAndFeel::drawKnobValueArc(juce::Graphics& g, juce::Rectangle<float> area,
+                                          float rotaryStartAngle, float angle,
+                                          juce::Colour accentColour, KnobType type)
+{
+    auto centreX = area.getCentreX();
+    auto centreY = area.getCentreY();
+    auto outerRadius = area.getWidth() / 2.0f * 0.92f;
+    auto knobRadius = outerRadius * 0.82f;
+    float arcRadius = (outerRadius + knobRadius) / 2.0f;
+    float arcThickness = (outerRadius - knobRadius) * 0.85f;
+    
+    juce::Path valueArc;
+    valueArc.addCentredArc(centreX, centreY, arcRadius, arcRadius, 
+                           0.0f, rotaryStartAngle, angle, true);
+    
+    // Create purple gradient for the value arc
+    juce::ColourGradient arcGradient(
+        accentColour.darker(0.3f),  // Darker purple at start
+        centreX + std::sin(rotaryStartAngle) * arcRadius,
+        centreY - std::cos(rotaryStartAngle) * arcRadius,
+        accentColour.brighter(0.1f),  // Lighter purple at end
+        centreX + std::sin(angle) * arcRadius,
+        centreY - std::cos(angle) * arcRadius,
+        false
+    );
+    
+    // Thinner arc on the large knob
+    g.setGradientFill(arcGradient);
+    g.strokePath(valueArc, juce::PathStrokeType(arcThickness * (type == KnobType::Large ? 0.75f : 0.85f), 
+                 juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+}
+
 //==============================================================================
 void CustomLookAndFeel::drawLabel(juce::Graphics& g, juce::Label& label)
 {
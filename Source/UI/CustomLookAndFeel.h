@@ -14,6 +14,7 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "KnobFilmstripCache.h"
 
 class CustomLookAndFeel : public juce::LookAndFeel_V4
 {
@@ -25,7 +26,8 @@ public:
                           float sliderPosProportional, float rotaryStartAngle,
                           float rotaryEndAngle, juce::Slider& slider) override;
 
-    // Large featured knob (for Target) with hover support
+    // Large featured knob (for Target) with hover support. Drawn from the
+    // shared knob filmstrip cache once its strip is ready.
     static void drawLargeKnob(juce::Graphics& g, juce::Rectangle<float> bounds,
                                float sliderPosProportional, float rotaryStartAngle,
                                float rotaryEndAngle, juce::Colour accentColour,
@@ -153,5 +155,30 @@ public:
     static void drawPanelWithBorder(juce::Graphics& g, juce::Rectangle<float> bounds, float cornerRadius = 6.0f);
 
 private:
+    //==========================================================================
+    // Knob layers, shared by the vector fallback and the filmstrip renderer so
+    // both look the same. Everything is laid out in a square knob area.
+    enum class KnobType { Rotary, Large };
+
+    static void drawKnob(juce::Graphics& g, KnobFilmstripCache& cache, juce::Rectangle<float> bounds,
+                         float sliderPosProportional, float rotaryStartAngle, float rotaryEndAngle,
+                         juce::Colour accentColour, KnobType type, bool isHovered, bool isDisabled);
+
+    static void drawKnobBody(juce::Graphics& g, juce::Rectangle<float> area,
+                             float rotaryStartAngle, float rotaryEndAngle);
+
+    // Kept out of the strips so hovering never needs a second full strip
+    static void drawKnobHover(juce::Graphics& g, juce::Rectangle<float> area,
+                              juce::Colour accentColour, KnobType type);
+
+    static void drawKnobIndicator(juce::Graphics& g, juce::Rectangle<float> area, float angle,
+                                  juce::Colour indicatorColour);
+
+    static void drawKnobValueArc(juce::Graphics& g, juce::Rectangle<float> area,
+                                 float rotaryStartAngle, float angle,
+                                 juce::Colour accentColour, KnobType type);
+
+    juce::SharedResourcePointer<KnobFilmstripCache> knobFilmstrips;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CustomLookAndFeel)
 };
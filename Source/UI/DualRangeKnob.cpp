@@ -169,11 +169,94 @@ void DualRangeKnob::paint(juce::Graphics& g)
     drawDualArcKnob(g, bounds);
 }
 
+namespace
+{
+    // Hover glow drawn into the knob body
+    enum class DualKnobGlow { None, Whole, Boost, Cut };
+
+    /** Static layers: background, rings, both grooves, gradient body and hover glow */
+    void drawDualKnobBody(juce::Graphics& g, juce::Rectangle<float> area, juce::Colour purpleColour,
+                          juce::Colour outerMetallicColour, bool isHovered, DualKnobGlow glow)
+    {
+        auto centreX = area.getCentreX();
+        auto centreY = area.getCentreY();
+        auto outerRadius = area.getWidth() / 2.0f * 0.92f;
+        auto knobBodyRadius = outerRadius * 0.68f;    // Larger inner body
+
+        float outerArcRadius = (outerRadius + outerRadius * 0.85f) / 2.0f;
+        float outerArcThickness = (outerRadius - outerRadius * 0.85f) * 0.50f;
+
+        float innerArcOuter = outerRadius * 0.82f;
+        float innerArcRadius = (innerArcOuter + knobBodyRadius) / 2.0f;
+        float innerArcThickness = (innerArcOuter - knobBodyRadius) * 0.70f;
+
+        // Opaque circular background
+        g.setColour(juce::Colour(0xFF0D0E11));
+        g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
+                      outerRadius * 2.0f, outerRadius * 2.0f);
+
+        // Outer ring border
+        g.setColour(isHovered ? juce::Colour(0xFF4A4D55) : juce::Colour(0xFF3A3D45));
+        g.drawEllipse(centreX - outerRadius, centreY - outerRadius,
+                      outerRadius * 2.0f, outerRadius * 2.0f, 1.0f);
+
+        // === OUTER ARC GROOVE (boost) ===
+        juce::Path outerGroove;
+        outerGroove.addCentredArc(centreX, centreY, outerArcRadius, outerArcRadius,
+                                   0.0f, rotaryStartAngle, rotaryEndAngle, true);
+        g.setColour(juce::Colour(0xFF151619));
+        g.strokePath(outerGroove, juce::PathStrokeType(outerArcThickness,
+                     juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+
+        // === INNER ARC GROOVE (cut) ===
+        juce::Path innerGroove;
+        innerGroove.addCentredArc(centreX, centreY, innerArcRadius, innerArcRadius,
+                                   0.0f, rotaryStartAngle, rotaryEndAngle, true);
+        g.setColour(juce::Colour(0xFF151619));
+        g.strokePath(innerGroove, juce::PathStrokeType(innerArcThickness,
+                     juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+
+        // Main knob body with gradient
+        auto knobBounds = juce::Rectangle<float>(
+            centreX - knobBodyRadius, centreY - knobBodyRadius,
+            knobBodyRadius * 2.0f, knobBodyRadius * 2.0f);
+
+        juce::ColourGradient knobGradient(
+            juce::Colour(0xFF1E2028), centreX, centreY - knobBodyRadius,
+            juce::Colour(0xFF353840), centreX, centreY + knobBodyRadius, false);
+        juce::Path knobPath;
+        knobPath.addEllipse(knobBounds);
+        g.setGradientFill(knobGradient);
+        g.fillPath(knobPath);
+
+        // Hover glow
+        if (glow == DualKnobGlow::Boost)
+        {
+            g.setColour(outerMetallicColour.withAlpha(0.06f));
+            g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
+                          outerRadius * 2.0f, outerRadius * 2.0f);
+        }
+        else if (glow == DualKnobGlow::Cut)
+        {
+            g.setColour(purpleColour.withAlpha(0.06f));
+            g.fillEllipse(knobBounds.expanded(3.0f));
+        }
+        else if (glow == DualKnobGlow::Whole)
+        {
+            g.setColour(purpleColour.withAlpha(0.05f));
+            g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
+                          outerRadius * 2.0f, outerRadius * 2.0f);
+        }
+    }
+}
+
 void DualRangeKnob::drawDualArcKnob(juce::Graphics& g, juce::Rectangle<float> bounds)
 {
-    auto centreX = bounds.getCentreX();
-    auto centreY = bounds.getCentreY();
-    auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f * 0.92f;
+    auto side = juce::jmin(bounds.getWidth(), bounds.getHeight());
+    auto area = bounds.withSizeKeepingCentre(side, side);
+    auto centreX = area.getCentreX();
+    auto centreY = area.getCentreY();
+    auto radius = side / 2.0f * 0.92f;
     bool isHovered = mouseHovering;
 
     bool isDisabled = !isEnabled();
@@ -197,65 +280,33 @@ void DualRangeKnob::drawDualArcKnob(juce::Graphics& g, juce::Rectangle<float> bo
     float innerArcRadius = (innerArcOuter + knobBodyRadius) / 2.0f;
     float innerArcThickness = (innerArcOuter - knobBodyRadius) * 0.70f;
 
-    // Opaque circular background
-    g.setColour(juce::Colour(0xFF0D0E11));
-    g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
-                  outerRadius * 2.0f, outerRadius * 2.0f);
-
-    // Outer ring border
-    g.setColour(isHovered ? juce::Colour(0xFF4A4D55) : juce::Colour(0xFF3A3D45));
-    g.drawEllipse(centreX - outerRadius, centreY - outerRadius,
-                  outerRadius * 2.0f, outerRadius * 2.0f, 1.0f);
-
-    // === OUTER ARC GROOVE (boost) ===
-    juce::Path outerGroove;
-    outerGroove.addCentredArc(centreX, centreY, outerArcRadius, outerArcRadius,
-                               0.0f, rotaryStartAngle, rotaryEndAngle, true);
-    g.setColour(juce::Colour(0xFF151619));
-    g.strokePath(outerGroove, juce::PathStrokeType(outerArcThickness,
-                 juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-
-    // === INNER ARC GROOVE (cut) ===
-    juce::Path innerGroove;
-    innerGroove.addCentredArc(centreX, centreY, innerArcRadius, innerArcRadius,
-                               0.0f, rotaryStartAngle, rotaryEndAngle, true);
-    g.setColour(juce::Colour(0xFF151619));
-    g.strokePath(innerGroove, juce::PathStrokeType(innerArcThickness,
-                 juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-
-    // Main knob body with gradient
-    auto knobBounds = juce::Rectangle<float>(
-        centreX - knobBodyRadius, centreY - knobBodyRadius,
-        knobBodyRadius * 2.0f, knobBodyRadius * 2.0f);
-
-    juce::ColourGradient knobGradient(
-        juce::Colour(0xFF1E2028), centreX, centreY - knobBodyRadius,
-        juce::Colour(0xFF353840), centreX, centreY + knobBodyRadius, false);
-    juce::Path knobPath;
-    knobPath.addEllipse(knobBounds);
-    g.setGradientFill(knobGradient);
-    g.fillPath(knobPath);
-
-    // Hover glow
+    auto glow = DualKnobGlow::None;
     if (isHovered && !locked)
+        glow = hoverRing == DragRing::Boost ? DualKnobGlow::Boost
+             : hoverRing == DragRing::Cut   ? DualKnobGlow::Cut
+                                            : DualKnobGlow::None;
+    else if (isHovered && locked)
+        glow = DualKnobGlow::Whole;
+
+    // Static layers come from a pre-rendered single-frame strip once it's ready
+    // (the two indicators move independently, so they stay vector)
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto key = KnobFilmstripCache::makeKey(KnobFilmstripCache::dualRangeKnobStyle,
+                                                 static_cast<int>(glow) | (isHovered ? 4 : 0) | (isDisabled ? 8 : 0),
+                                                 area, pixelScale, purpleColour, rotaryStartAngle, rotaryEndAngle);
+
+    if (auto strip = filmstrips->find(key))
     {
-        if (hoverRing == DragRing::Boost)
-        {
-            g.setColour(outerMetallicColour.withAlpha(0.06f));
-            g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
-                          outerRadius * 2.0f, outerRadius * 2.0f);
-        }
-        else if (hoverRing == DragRing::Cut)
-        {
-            g.setColour(purpleColour.withAlpha(0.06f));
-            g.fillEllipse(knobBounds.expanded(3.0f));
-        }
+        strip->draw(g, area, 0.0f);
     }
-    else if (isHovered && locked)
+    else
     {
-        g.setColour(purpleColour.withAlpha(0.05f));
-        g.fillEllipse(centreX - outerRadius, centreY - outerRadius,
-                      outerRadius * 2.0f, outerRadius * 2.0f);
+        filmstrips->request(key, 1, [=](juce::Graphics& sg, juce::Rectangle<float> stripArea)
+        {
+            drawDualKnobBody(sg, stripArea, purpleColour, outerMetallicColour, isHovered, glow);
+        });
+
+        drawDualKnobBody(g, area, purpleColour, outerMetallicColour, isHovered, glow);
     }
 
     // === OUTER VALUE ARC (boost - cyan) ===
@@ -18,6 +18,7 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "CustomLookAndFeel.h"
+#include "KnobFilmstripCache.h"
 
 class DualRangeKnob : public juce::Component
 {
@@ -76,6 +77,8 @@ private:
     static constexpr float maxDb = 12.0f;
     static constexpr float dragSensitivity = 0.15f;
 
+    juce::SharedResourcePointer<KnobFilmstripCache> filmstrips;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DualRangeKnob)
 };
 
@@ -0,0 +1,240 @@
+/*
+  ==============================================================================
+
+    InstanceDashboard.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "InstanceDashboard.h"
+#include "CustomLookAndFeel.h"
+#include <algorithm>
+
+namespace
+{
+    juce::String formatGain(float db)
+    {
+        return (db > 0.0f ? "+" : "") + juce::String(db, 1) + " dB";
+    }
+
+    juce::String formatLoad(float load)
+    {
+        return juce::String(load * 100.0f, 1) + "%";
+    }
+}
+
+InstanceDashboard::InstanceDashboard(int ownSlotIndex)
+    : ownSlot(ownSlotIndex)
+{
+    auto& header = table.getHeader();
+    const int sortable = juce::TableHeaderComponent::defaultFlags;
+    header.addColumn("Track",     trackColumn,    150, 80, -1, sortable);
+    header.addColumn("CPU",       cpuColumn,       60, 50, -1, sortable);
+    header.addColumn("Peak",      peakCpuColumn,   60, 50, -1, sortable);
+    header.addColumn("Mode",      modeColumn,     150, 80, -1, sortable);
+    header.addColumn("Gain",      gainColumn,      64, 50, -1, sortable);
+    header.addColumn("Min",       minGainColumn,   64, 50, -1, sortable);
+    header.addColumn("Max",       maxGainColumn,   64, 50, -1, sortable);
+    header.addColumn("Mean",      meanGainColumn,  64, 50, -1, sortable);
+    header.addColumn("Latency",   latencyColumn,   70, 50, -1, sortable);
+    header.setSortColumnId(sortColumn, sortForwards);
+    header.setColour(juce::TableHeaderComponent::backgroundColourId, CustomLookAndFeel::getSurfaceColour());
+    header.setColour(juce::TableHeaderComponent::textColourId, CustomLookAndFeel::getDimTextColour());
+    header.setColour(juce::TableHeaderComponent::outlineColourId, CustomLookAndFeel::getBorderColour());
+
+    table.setColour(juce::ListBox::backgroundColourId, CustomLookAndFeel::getSurfaceDarkColour().withAlpha(0.6f));
+    table.setColour(juce::ListBox::outlineColourId, CustomLookAndFeel::getBorderColour());
+    table.setOutlineThickness(1);
+    table.setRowHeight(20);
+    addAndMakeVisible(table);
+
+    closeButton.onClick = [this] { if (onClose) onClose(); };
+    addAndMakeVisible(closeButton);
+
+    setWantsKeyboardFocus(true);
+    refresh();
+    startTimerHz(4);
+}
+
+InstanceDashboard::~InstanceDashboard()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void InstanceDashboard::paint(juce::Graphics& g)
+{
+    // Dim the editor behind the panel
+    g.fillAll(juce::Colours::black.withAlpha(0.55f));
+
+    g.setColour(CustomLookAndFeel::getBackgroundColour());
+    g.fillRoundedRectangle(panelBounds, 10.0f);
+    g.setColour(CustomLookAndFeel::getBorderColour().withAlpha(0.6f));
+    g.drawRoundedRectangle(panelBounds, 10.0f, 1.0f);
+
+    // Accent line
+    g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.5f));
+    g.fillRoundedRectangle(panelBounds.getX() + 30.0f, panelBounds.getY() + 4.0f, panelBounds.getWidth() - 60.0f, 2.0f, 1.0f);
+
+    auto titleArea = panelBounds.reduced(16.0f, 0.0f).withHeight(40.0f).translated(0.0f, 8.0f);
+    g.setColour(CustomLookAndFeel::getTextColour());
+    g.setFont(CustomLookAndFeel::getPluginFont(13.0f, true));
+    g.drawText("magic.RIDE Instances", titleArea, juce::Justification::centredLeft);
+
+    g.setColour(CustomLookAndFeel::getDimTextColour());
+    g.setFont(CustomLookAndFeel::getPluginFont(10.0f));
+    g.drawText(summaryText, titleArea, juce::Justification::centredRight);
+}
+
+void InstanceDashboard::resized()
+{
+    panelBounds = getLocalBounds().toFloat().reduced(24.0f);
+
+    auto area = panelBounds.toNearestInt().reduced(16, 0);
+    area.removeFromTop(52);
+    auto buttonRow = area.removeFromBottom(40);
+    closeButton.setBounds(buttonRow.removeFromRight(80).withSizeKeepingCentre(80, 24));
+    table.setBounds(area.withTrimmedBottom(4));
+}
+
+bool InstanceDashboard::keyPressed(const juce::KeyPress& key)
+{
+    if (key == juce::KeyPress::escapeKey)
+    {
+        if (onClose)
+            onClose();
+        return true;
+    }
+    return false;
+}
+
+//==============================================================================
+void InstanceDashboard::timerCallback()
+{
+    refresh();
+}
+
+void InstanceDashboard::refresh()
+{
+    instances = InstanceRegistry::getInstance().getInstances();
+    sortInstances();
+
+    float totalLoad = 0.0f;
+    for (const auto& info : instances)
+        totalLoad += info.cpuLoad;
+
+    summaryText = juce::String(static_cast<int>(instances.size()))
+                + (instances.size() == 1 ? " instance" : " instances")
+                + ", " + formatLoad(totalLoad) + " total";
+
+    table.updateContent();
+    table.repaint();
+    repaint(panelBounds.toNearestInt().withHeight(56));
+}
+
+void InstanceDashboard::sortOrderChanged(int newSortColumnId, bool isForwards)
+{
+    sortColumn = newSortColumnId;
+    sortForwards = isForwards;
+    sortInstances();
+    table.updateContent();
+    table.repaint();
+}
+
+void InstanceDashboard::sortInstances()
+{
+    auto key = [this](const InstanceRegistry::InstanceInfo& info) -> float
+    {
+        switch (sortColumn)
+        {
+            case cpuColumn:      return info.cpuLoad;
+            case peakCpuColumn:  return info.peakCpuLoad;
+            case modeColumn:     return static_cast<float>(info.modeFlags);
+            case gainColumn:     return info.gainDb;
+            case minGainColumn:  return info.minGainDb;
+            case maxGainColumn:  return info.maxGainDb;
+            case meanGainColumn: return info.meanGainDb;
+            case latencyColumn:  return static_cast<float>(info.latencySamples);
+            default:             return 0.0f;
+        }
+    };
+
+    std::stable_sort(instances.begin(), instances.end(),
+                     [&](const InstanceRegistry::InstanceInfo& a, const InstanceRegistry::InstanceInfo& b)
+                     {
+                         if (sortColumn == trackColumn)
+                         {
+                             const int order = a.name.compareNatural(b.name);
+                             return sortForwards ? order < 0 : order > 0;
+                         }
+                         return sortForwards ? key(a) < key(b) : key(a) > key(b);
+                     });
+}
+
+//==============================================================================
+int InstanceDashboard::getNumRows()
+{
+    return static_cast<int>(instances.size());
+}
+
+void InstanceDashboard::paintRowBackground(juce::Graphics& g, int row, int /*width*/, int /*height*/, bool selected)
+{
+    if (row < 0 || row >= getNumRows())
+        return;
+
+    if (selected)
+        g.fillAll(CustomLookAndFeel::getAccentColour().withAlpha(0.25f));
+    else if (instances[static_cast<size_t>(row)].slotIndex == ownSlot)
+        g.fillAll(CustomLookAndFeel::getAccentColour().withAlpha(0.12f));
+    else if (row % 2 == 1)
+        g.fillAll(CustomLookAndFeel::getSurfaceColour().withAlpha(0.5f));
+}
+
+void InstanceDashboard::paintCell(juce::Graphics& g, int row, int columnId, int width, int height, bool /*selected*/)
+{
+    if (row < 0 || row >= getNumRows())
+        return;
+
+    const auto& info = instances[static_cast<size_t>(row)];
+
+    juce::String text;
+    auto colour = info.processing ? CustomLookAndFeel::getTextColour() : CustomLookAndFeel::getVeryDimTextColour();
+    auto justification = juce::Justification::centredRight;
+
+    switch (columnId)
+    {
+        case trackColumn:
+            text = info.name;
+            justification = juce::Justification::centredLeft;
+            break;
+        case cpuColumn:
+            text = formatLoad(info.cpuLoad);
+            if (info.processing && info.cpuLoad > 0.1f)
+                colour = CustomLookAndFeel::getWarningColour();
+            break;
+        case peakCpuColumn:  text = formatLoad(info.peakCpuLoad); break;
+        case modeColumn:
+            text = InstanceRegistry::describeMode(info.modeFlags);
+            justification = juce::Justification::centredLeft;
+            if (info.processing)
+                colour = CustomLookAndFeel::getDimTextColour();
+            break;
+        case gainColumn:     text = formatGain(info.gainDb); break;
+        case minGainColumn:  text = formatGain(info.minGainDb); break;
+        case maxGainColumn:  text = formatGain(info.maxGainDb); break;
+        case meanGainColumn: text = formatGain(info.meanGainDb); break;
+        case latencyColumn:
+            text = info.sampleRate > 0.0
+                 ? juce::String(1000.0 * info.latencySamples / info.sampleRate, 1) + " ms"
+                 : juce::String(info.latencySamples) + " smp";
+            break;
+        default:
+            break;
+    }
+
+    g.setColour(colour);
+    g.setFont(CustomLookAndFeel::getPluginFont(11.0f));
+    g.drawText(text, 6, 0, width - 12, height, justification, true);
+}
@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    InstanceDashboard.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Session-wide view of every magic.RIDE instance (see InstanceRegistry):
+    track, CPU load, mode, gain statistics and latency, sortable by any
+    column. Polls the registry a few times a second on the message thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include <vector>
+#include "../IO/InstanceRegistry.h"
+
+class InstanceDashboard : public juce::Component,
+                          private juce::TableListBoxModel,
+                          private juce::Timer
+{
+public:
+    /** @param ownSlotIndex Registry slot of the instance showing the dashboard (highlighted) */
+    explicit InstanceDashboard(int ownSlotIndex);
+    ~InstanceDashboard() override;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    bool keyPressed(const juce::KeyPress& key) override;
+    void mouseDown(const juce::MouseEvent&) override {}   // Block clicks behind
+
+    std::function<void()> onClose;
+
+private:
+    //==============================================================================
+    enum ColumnId { trackColumn = 1, cpuColumn, peakCpuColumn, modeColumn, gainColumn,
+                    minGainColumn, maxGainColumn, meanGainColumn, latencyColumn };
+
+    // TableListBoxModel
+    int getNumRows() override;
+    void paintRowBackground(juce::Graphics& g, int row, int width, int height, bool selected) override;
+    void paintCell(juce::Graphics& g, int row, int columnId, int width, int height, bool selected) override;
+    void sortOrderChanged(int newSortColumnId, bool isForwards) override;
+
+    void timerCallback() override;
+    void refresh();
+    void sortInstances();
+
+    //==============================================================================
+    const int ownSlot;
+    std::vector<InstanceRegistry::InstanceInfo> instances;
+    int sortColumn = cpuColumn;
+    bool sortForwards = false;   // Most expensive first
+
+    juce::TableListBox table { "Instances", this };
+    juce::TextButton closeButton { "Close" };
+    juce::Rectangle<float> panelBounds;
+    juce::String summaryText;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(InstanceDashboard)
+};
@@ -0,0 +1,265 @@
+/*
+  ==============================================================================
+
+    KnobFilmstripCache.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "KnobFilmstripCache.h"
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+const juce::Image& KnobFilmstrip::getFrame(float sliderPosProportional) const
+{
+    const int lastFrame = static_cast<int>(frames.size()) - 1;
+    const int index = juce::jlimit(0, lastFrame, juce::roundToInt(sliderPosProportional * static_cast<float>(lastFrame)));
+    return frames[static_cast<size_t>(index)];
+}
+
+void KnobFilmstrip::draw(juce::Graphics& g, juce::Rectangle<float> area, float sliderPosProportional) const
+{
+    const auto& frame = getFrame(sliderPosProportional);
+    g.drawImageTransformed(frame, juce::AffineTransform::scale(area.getWidth() / static_cast<float>(frame.getWidth()))
+                                                        .translated(area.getX(), area.getY()));
+}
+
+size_t KnobFilmstrip::getSizeInBytes() const
+{
+    return static_cast<size_t>(strip.getWidth()) * static_cast<size_t>(strip.getHeight()) * 4;
+}
+
+//==============================================================================
+KnobFilmstripCache::KnobFilmstripCache()
+    : juce::Thread("magic.RIDE Knob Filmstrips")
+{
+    startThread(juce::Thread::Priority::low);
+}
+
+KnobFilmstripCache::~KnobFilmstripCache()
+{
+    signalThreadShouldExit();
+    notify();
+    stopThread(4000);
+}
+
+//==============================================================================
+KnobFilmstripCache::Key KnobFilmstripCache::makeKey(int style, int variant, juce::Rectangle<float> area,
+                                                    float pixelScale, juce::Colour accentColour,
+                                                    float rotaryStartAngle, float rotaryEndAngle)
+{
+    Key key;
+    key.style = style;
+    key.variant = variant;
+    key.sizePx = juce::roundToInt(area.getWidth() * pixelScale);
+    key.scalePercent = juce::roundToInt(pixelScale * 100.0f);
+    key.argb = accentColour.getARGB();
+    key.startAngle = rotaryStartAngle;
+    key.endAngle = rotaryEndAngle;
+    return key;
+}
+
+int KnobFilmstripCache::getFramesForTravel(float tipRadius, float rotaryStartAngle, float rotaryEndAngle,
+                                           float pixelScale)
+{
+    const float travelPx = tipRadius * pixelScale * std::abs(rotaryEndAngle - rotaryStartAngle);
+    return juce::jlimit(16, maxFrames, juce::roundToInt(travelPx / 2.0f) + 1);
+}
+
+//==============================================================================
+std::shared_ptr<const KnobFilmstrip> KnobFilmstripCache::find(const Key& key)
+{
+    std::shared_ptr<const KnobFilmstrip> software;
+    {
+        const juce::ScopedLock sl(lock);
+
+        auto it = strips.find(key);
+        if (it == strips.end())
+            return nullptr;
+
+        auto& entry = it->second;
+        entry.lastUsed = ++useCounter;
+        if (entry.isNative)
+            return entry.strip;
+
+        software = entry.strip;
+    }
+
+    // Strips are rendered into software images; convert once here so each
+    // blit doesn't re-upload the pixels (Direct2D, CoreGraphics). Done outside
+    // the lock so the worker can keep publishing meanwhile.
+    auto native = std::make_shared<KnobFilmstrip>();
+    native->strip = juce::NativeImageType().convert(software->strip);
+
+    const int side = native->strip.getWidth();
+    const auto numFrames = software->frames.size();
+    native->frames.reserve(numFrames);
+    for (size_t frame = 0; frame < numFrames; ++frame)
+        native->frames.push_back(numFrames == 1 ? native->strip
+                                                : native->strip.getClippedImage({ 0, static_cast<int>(frame) * side, side, side }));
+
+    const juce::ScopedLock sl(lock);
+
+    // Only replace the strip that was converted (it may have been evicted or re-rendered)
+    auto it = strips.find(key);
+    if (it != strips.end() && it->second.strip == software)
+    {
+        it->second.strip = native;
+        it->second.isNative = true;
+    }
+
+    return native;
+}
+
+void KnobFilmstripCache::request(const Key& key, int numFrames, BodyPainter body, IndicatorPainter indicator)
+{
+    if (key.sizePx <= 0 || body == nullptr)
+        return;
+
+    {
+        const juce::ScopedLock sl(lock);
+
+        if (strips.count(key) > 0)
+            return;
+
+        for (const auto& job : pendingJobs)
+            if (!(job.key < key) && !(key < job.key))
+                return;
+
+        // A resize can queue a burst of sizes nobody draws any more - keep the newest
+        if (static_cast<int>(pendingJobs.size()) >= maxPendingJobs)
+            pendingJobs.erase(pendingJobs.begin());
+
+        // Big knobs at high display scales get fewer frames rather than a strip
+        // that pushes everything else out of the budget
+        const auto frameBytes = static_cast<size_t>(key.sizePx) * static_cast<size_t>(key.sizePx) * 4;
+        const int framesInBudget = static_cast<int>(juce::jlimit(static_cast<size_t>(2), static_cast<size_t>(maxFrames),
+                                                                 maxStripBytes / juce::jmax(static_cast<size_t>(1), frameBytes)));
+
+        Job job;
+        job.key = key;
+        job.numFrames = indicator != nullptr ? juce::jlimit(2, framesInBudget, numFrames) : 1;
+        job.body = std::move(body);
+        job.indicator = std::move(indicator);
+        pendingJobs.push_back(std::move(job));
+    }
+
+    notify();
+}
+
+//==============================================================================
+void KnobFilmstripCache::run()
+{
+    while (!threadShouldExit())
+    {
+        Job job;
+        bool haveJob = false;
+        {
+            const juce::ScopedLock sl(lock);
+            if (!pendingJobs.empty())
+            {
+                job = std::move(pendingJobs.front());
+                pendingJobs.erase(pendingJobs.begin());
+                haveJob = true;
+            }
+        }
+
+        if (!haveJob)
+        {
+            wait(-1);
+            continue;
+        }
+
+        auto strip = render(job);
+        if (strip == nullptr)
+            continue;
+
+        const juce::ScopedLock sl(lock);
+        auto& entry = strips[job.key];
+        if (entry.strip != nullptr)
+            totalBytes -= entry.strip->getSizeInBytes();
+
+        totalBytes += strip->getSizeInBytes();
+        entry.strip = std::move(strip);
+        entry.isNative = false;
+        entry.lastUsed = ++useCounter;
+        evictToBudget(job.key);
+    }
+}
+
+std::shared_ptr<const KnobFilmstrip> KnobFilmstripCache::render(const Job& job)
+{
+    const int side = job.key.sizePx;
+    const float pixelScale = static_cast<float>(job.key.scalePercent) / 100.0f;
+    const auto logicalBounds = juce::Rectangle<float>(static_cast<float>(side) / pixelScale,
+                                                      static_cast<float>(side) / pixelScale);
+
+    // Software images: native ones (Direct2D, CoreGraphics) may not be drawn
+    // into off the message thread
+    juce::Image body(juce::Image::ARGB, side, side, true, juce::SoftwareImageType());
+    {
+        juce::Graphics g(body);
+        g.addTransform(juce::AffineTransform::scale(pixelScale));
+        job.body(g, logicalBounds);
+    }
+
+    auto strip = std::make_shared<KnobFilmstrip>();
+    if (job.indicator == nullptr)
+    {
+        strip->strip = body;
+        strip->frames.push_back(body);
+        return strip;
+    }
+
+    strip->strip = juce::Image(juce::Image::ARGB, side, side * job.numFrames, true, juce::SoftwareImageType());
+    strip->frames.reserve(static_cast<size_t>(job.numFrames));
+
+    juce::Graphics g(strip->strip);
+    for (int frame = 0; frame < job.numFrames; ++frame)
+    {
+        if ((frame & 7) == 0 && threadShouldExit())
+            return nullptr;
+
+        const int frameY = frame * side;
+        const float proportion = static_cast<float>(frame) / static_cast<float>(job.numFrames - 1);
+        const float angle = job.key.startAngle + proportion * (job.key.endAngle - job.key.startAngle);
+
+        g.drawImageAt(body, 0, frameY);
+        {
+            const juce::Graphics::ScopedSaveState state(g);
+            g.addTransform(juce::AffineTransform::scale(pixelScale).translated(0.0f, static_cast<float>(frameY)));
+            g.reduceClipRegion(logicalBounds.getSmallestIntegerContainer());
+            job.indicator(g, logicalBounds, angle);
+        }
+
+        strip->frames.push_back(strip->strip.getClippedImage({ 0, frameY, side, side }));
+    }
+
+    return strip;
+}
+
+void KnobFilmstripCache::evictToBudget(const Key& keep)
+{
+    while (totalBytes > memoryBudgetBytes && strips.size() > 1)
+    {
+        auto oldest = strips.end();
+        for (auto it = strips.begin(); it != strips.end(); ++it)
+        {
+            if (!(it->first < keep) && !(keep < it->first))
+                continue;
+
+            if (oldest == strips.end() || it->second.lastUsed < oldest->second.lastUsed)
+                oldest = it;
+        }
+
+        if (oldest == strips.end())
+            break;
+
+        // Knobs painting right now hold their own reference, so this is safe
+        totalBytes -= oldest->second.strip->getSizeInBytes();
+        strips.erase(oldest);
+    }
+}
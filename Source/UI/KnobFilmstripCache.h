@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    KnobFilmstripCache.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Pre-rendered knob filmstrips. The static part of a knob (background,
+    rings, grooves, gradient body, hover glow) and its indicator at a set of
+    quantised angles are rendered once per size, display scale and style on
+    a background thread, stacked into one image. A knob repaint is then a
+    single frame blit plus its value arc; until the strip for a style is
+    ready the caller draws the vector version, which looks the same, so
+    nothing needs repainting when the strip arrives.
+
+    One cache is shared by every editor in the process
+    (juce::SharedResourcePointer), and it stays within a memory budget by
+    dropping the least recently drawn strips.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+//==============================================================================
+/** One finished strip: numFrames frames of the same knob, stacked vertically. */
+struct KnobFilmstrip
+{
+    juce::Image strip;
+    std::vector<juce::Image> frames;    // Views into strip (no pixel copies)
+
+    /** Frame closest to this rotary position (0-1) */
+    const juce::Image& getFrame(float sliderPosProportional) const;
+
+    /** Blits the frame for this position so it covers area (message thread) */
+    void draw(juce::Graphics& g, juce::Rectangle<float> area, float sliderPosProportional) const;
+
+    size_t getSizeInBytes() const;
+};
+
+//==============================================================================
+class KnobFilmstripCache : private juce::Thread
+{
+public:
+    KnobFilmstripCache();
+    ~KnobFilmstripCache() override;
+
+    //==============================================================================
+    /** Knob types that share the cache */
+    enum Style { rotaryKnobStyle = 0, largeKnobStyle, dualRangeKnobStyle };
+
+    /** Everything the pixels of a strip depend on */
+    struct Key
+    {
+        int style = rotaryKnobStyle;
+        int variant = 0;            // Caller-defined state flags (hover, disabled, ...)
+        int sizePx = 0;             // Side of the square knob area in physical pixels
+        int scalePercent = 100;     // Display scale x editor scale
+        juce::uint32 argb = 0;      // Accent colour
+        float startAngle = 0.0f;
+        float endAngle = 0.0f;
+
+        bool operator<(const Key& other) const
+        {
+            return std::tie(style, variant, sizePx, scalePercent, argb, startAngle, endAngle)
+                 < std::tie(other.style, other.variant, other.sizePx, other.scalePercent,
+                            other.argb, other.startAngle, other.endAngle);
+        }
+    };
+
+    static Key makeKey(int style, int variant, juce::Rectangle<float> area, float pixelScale,
+                       juce::Colour accentColour, float rotaryStartAngle, float rotaryEndAngle);
+
+    /** Paints the static layers into bounds (logical pixels, worker thread) */
+    using BodyPainter = std::function<void(juce::Graphics&, juce::Rectangle<float>)>;
+
+    /** Paints the angle-dependent layer into bounds (logical pixels, worker thread) */
+    using IndicatorPainter = std::function<void(juce::Graphics&, juce::Rectangle<float>, float angle)>;
+
+    //==============================================================================
+    /** Finished strip for this key, or nullptr if it isn't rendered yet (message thread) */
+    std::shared_ptr<const KnobFilmstrip> find(const Key& key);
+
+    /** Queues a strip render; does nothing if the key is already queued or cached.
+        Painters run on the worker thread, so they must only use their captures.
+        Without an indicator painter the strip has a single frame. */
+    void request(const Key& key, int numFrames, BodyPainter body, IndicatorPainter indicator = {});
+
+    /** Frames needed for an indicator tip at tipRadius to move about two
+        physical pixels per frame across the rotary range. request() may use
+        fewer for large knobs, to keep each strip within maxStripBytes. */
+    static int getFramesForTravel(float tipRadius, float rotaryStartAngle, float rotaryEndAngle,
+                                  float pixelScale);
+
+    static constexpr int maxFrames = 128;
+    static constexpr int maxPendingJobs = 16;
+    static constexpr size_t maxStripBytes = 12 * 1024 * 1024;   // A quarter of the budget
+    static constexpr size_t memoryBudgetBytes = 48 * 1024 * 1024;
+
+private:
+    //==============================================================================
+    struct Job
+    {
+        Key key;
+        int numFrames = 1;
+        BodyPainter body;
+        IndicatorPainter indicator;
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<const KnobFilmstrip> strip;
+        juce::uint64 lastUsed = 0;
+        bool isNative = false;          // Converted to the native image type (message thread)
+    };
+
+    void run() override;
+    std::shared_ptr<const KnobFilmstrip> render(const Job& job);
+    void evictToBudget(const Key& keep);
+
+    juce::CriticalSection lock;
+    std::map<Key, Entry> strips;
+    std::vector<Job> pendingJobs;
+    size_t totalBytes = 0;
+    juce::uint64 useCounter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(KnobFilmstripCache)
+};
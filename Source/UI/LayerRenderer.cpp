@@ -0,0 +1,185 @@
+/*
+  ==============================================================================
+
+    LayerRenderer.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "LayerRenderer.h"
+#include <algorithm>
+
+//==============================================================================
+void CachedLayer::draw(juce::Graphics& g, juce::Rectangle<int> currentBounds) const
+{
+    if (image.isNull())
+        return;
+
+    if (bounds == currentBounds)
+    {
+        // Undo the device scale: the image maps 1:1 onto physical pixels
+        g.drawImageTransformed(image, juce::AffineTransform::scale(1.0f / pixelScale)
+                                                            .translated(static_cast<float>(bounds.getX()),
+                                                                        static_cast<float>(bounds.getY())));
+        return;
+    }
+
+    g.drawImage(image, currentBounds.toFloat(), juce::RectanglePlacement::stretchToFit);
+}
+
+//==============================================================================
+LayerRenderer::LayerRenderer(const juce::String& threadName)
+    : juce::Thread(threadName)
+{
+    startThread(juce::Thread::Priority::normal);
+}
+
+LayerRenderer::~LayerRenderer()
+{
+    cancelPendingUpdate();
+    signalThreadShouldExit();
+    notify();
+    stopThread(4000);
+}
+
+//==============================================================================
+void LayerRenderer::request(int layerId, juce::Rectangle<int> bounds, float pixelScale, Painter painter)
+{
+    if (bounds.isEmpty() || pixelScale <= 0.0f || painter == nullptr)
+        return;
+
+    {
+        const juce::ScopedLock sl(lock);
+
+        auto& state = layers[layerId];
+        if (state.latestSequence > state.cancelledSequence
+            && state.latestBounds == bounds && state.latestScale == pixelScale)
+            return;
+
+        state.latestSequence = nextSequence++;
+        state.latestBounds = bounds;
+        state.latestScale = pixelScale;
+
+        // While the window is being dragged only the newest size is worth rendering
+        pendingJobs.erase(std::remove_if(pendingJobs.begin(), pendingJobs.end(),
+                                         [layerId](const Job& job) { return job.layerId == layerId; }),
+                          pendingJobs.end());
+
+        Job job;
+        job.layerId = layerId;
+        job.sequence = state.latestSequence;
+        job.bounds = bounds;
+        job.pixelScale = pixelScale;
+        job.painter = std::move(painter);
+        pendingJobs.push_back(std::move(job));
+    }
+
+    notify();
+}
+
+void LayerRenderer::cancel(int layerId)
+{
+    const juce::ScopedLock sl(lock);
+
+    auto& state = layers[layerId];
+    state.cancelledSequence = state.latestSequence;
+
+    pendingJobs.erase(std::remove_if(pendingJobs.begin(), pendingJobs.end(),
+                                     [layerId](const Job& job) { return job.layerId == layerId; }),
+                      pendingJobs.end());
+}
+
+CachedLayer LayerRenderer::render(juce::Rectangle<int> bounds, float pixelScale, const Painter& painter,
+                                  const juce::ImageType& imageType)
+{
+    CachedLayer layer;
+    if (bounds.isEmpty() || pixelScale <= 0.0f)
+        return layer;
+
+    layer.bounds = bounds;
+    layer.pixelScale = pixelScale;
+    layer.image = juce::Image(juce::Image::ARGB,
+                              juce::jmax(1, juce::roundToInt(static_cast<float>(bounds.getWidth()) * pixelScale)),
+                              juce::jmax(1, juce::roundToInt(static_cast<float>(bounds.getHeight()) * pixelScale)),
+                              true, imageType);
+
+    juce::Graphics g(layer.image);
+    g.addTransform(juce::AffineTransform::translation(static_cast<float>(-bounds.getX()),
+                                                      static_cast<float>(-bounds.getY()))
+                                         .scaled(pixelScale));
+    painter(g);
+    return layer;
+}
+
+//==============================================================================
+void LayerRenderer::run()
+{
+    while (!threadShouldExit())
+    {
+        Job job;
+        bool haveJob = false;
+        {
+            const juce::ScopedLock sl(lock);
+            if (!pendingJobs.empty())
+            {
+                job = std::move(pendingJobs.front());
+                pendingJobs.erase(pendingJobs.begin());
+                haveJob = true;
+            }
+        }
+
+        if (!haveJob)
+        {
+            wait(-1);
+            continue;
+        }
+
+        // Native images (Direct2D, CoreGraphics) may not be drawn into off the message thread
+        auto layer = render(job.bounds, job.pixelScale, job.painter, juce::SoftwareImageType());
+
+        {
+            const juce::ScopedLock sl(lock);
+            if (isCancelled(job.layerId, job.sequence))
+                continue;
+
+            // Only the newest finished render of each layer is worth delivering
+            finished.erase(std::remove_if(finished.begin(), finished.end(),
+                                          [&job](const Finished& f) { return f.layerId == job.layerId; }),
+                           finished.end());
+            finished.push_back({ job.layerId, job.sequence, std::move(layer) });
+        }
+
+        triggerAsyncUpdate();
+    }
+}
+
+void LayerRenderer::handleAsyncUpdate()
+{
+    std::vector<Finished> ready;
+    {
+        const juce::ScopedLock sl(lock);
+        ready.swap(finished);
+
+        // Cancelled between finishing and now
+        ready.erase(std::remove_if(ready.begin(), ready.end(),
+                                   [this](const Finished& f) { return isCancelled(f.layerId, f.sequence); }),
+                    ready.end());
+    }
+
+    for (auto& f : ready)
+    {
+        // Converted once here so the per-frame blits don't re-upload the pixels
+        f.layer.image = juce::NativeImageType().convert(f.layer.image);
+
+        if (onLayerReady != nullptr)
+            onLayerReady(f.layerId, f.layer);
+    }
+}
+
+bool LayerRenderer::isCancelled(int layerId, int sequence) const
+{
+    auto it = layers.find(layerId);
+    return it != layers.end() && sequence <= it->second.cancelledSequence;
+}
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    LayerRenderer.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Background re-rasterisation of cached UI layers (editor chrome, waveform
+    background and overlay). When a component changes size the new layer is
+    rendered on a worker thread while the previous image is drawn stretched
+    over the new bounds as a placeholder, so dragging the window corner never
+    waits for a full re-render on the message thread.
+
+    Painters run on the worker, so they must only use what they captured
+    (copies of the layout and parameters) - never the component itself.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+//==============================================================================
+/** A cached layer and the logical bounds and device scale it was rendered for. */
+struct CachedLayer
+{
+    juce::Image image;
+    juce::Rectangle<int> bounds;
+    float pixelScale = 0.0f;
+
+    bool isNull() const { return image.isNull(); }
+
+    /** True if this is an exact render for these bounds and scale */
+    bool matches(juce::Rectangle<int> currentBounds, float currentScale) const
+    {
+        return !image.isNull() && bounds == currentBounds && pixelScale == currentScale;
+    }
+
+    /** Blits 1:1 onto physical pixels when the bounds match; otherwise stretches
+        the image over currentBounds as a placeholder */
+    void draw(juce::Graphics& g, juce::Rectangle<int> currentBounds) const;
+};
+
+//==============================================================================
+class LayerRenderer : private juce::Thread,
+                      private juce::AsyncUpdater
+{
+public:
+    using Painter = std::function<void(juce::Graphics&)>;
+
+    explicit LayerRenderer(const juce::String& threadName);
+    ~LayerRenderer() override;
+
+    //==============================================================================
+    /** Queues a background render of one layer (message thread). Replaces a
+        queued render of the same layer, and does nothing if the latest request
+        for the layer already has these bounds and scale. */
+    void request(int layerId, juce::Rectangle<int> bounds, float pixelScale, Painter painter);
+
+    /** Drops queued and in-flight renders of a layer, e.g. before rendering it
+        synchronously with newer content (message thread) */
+    void cancel(int layerId);
+
+    /** Renders a layer on the calling thread. Off the message thread only
+        software images may be drawn into. */
+    static CachedLayer render(juce::Rectangle<int> bounds, float pixelScale, const Painter& painter,
+                              const juce::ImageType& imageType = juce::NativeImageType());
+
+    /** Called on the message thread with each finished layer. A layer for
+        bounds that have changed again since is still delivered: it is the
+        closest placeholder until the latest request lands. */
+    std::function<void(int layerId, const CachedLayer& layer)> onLayerReady;
+
+private:
+    //==============================================================================
+    struct Job
+    {
+        int layerId = 0;
+        int sequence = 0;
+        juce::Rectangle<int> bounds;
+        float pixelScale = 1.0f;
+        Painter painter;
+    };
+
+    struct LayerState
+    {
+        int latestSequence = 0;         // Last request
+        int cancelledSequence = 0;      // Requests up to here are dropped
+        juce::Rectangle<int> latestBounds;
+        float latestScale = 0.0f;
+    };
+
+    struct Finished
+    {
+        int layerId = 0;
+        int sequence = 0;
+        CachedLayer layer;
+    };
+
+    void run() override;
+    void handleAsyncUpdate() override;
+    bool isCancelled(int layerId, int sequence) const;
+
+    juce::CriticalSection lock;
+    std::vector<Job> pendingJobs;
+    std::vector<Finished> finished;
+    std::map<int, LayerState> layers;
+    int nextSequence = 1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LayerRenderer)
+};
@@ -0,0 +1,387 @@
+/*
+  ==============================================================================
+
+    OverviewStrip.cpp
+    Created: 2026
+    Author:  MBM Audio
+
+  ==============================================================================
+*/
+
+#include "OverviewStrip.h"
+#include "CustomLookAndFeel.h"
+#include <cmath>
+
+OverviewStrip::OverviewStrip()
+{
+    setOpaque(true);
+
+    builder.onOverviewReady = [this]
+    {
+        overview = builder.getOverview();
+        overviewNeedsRedraw = true;
+        repaint();
+    };
+
+    startTimerHz(30);
+}
+
+OverviewStrip::~OverviewStrip()
+{
+    stopTimer();
+    builder.onOverviewReady = nullptr;
+    builder.cancel();
+}
+
+//==============================================================================
+void OverviewStrip::loadFile(const juce::File& file, const RideSettings& settings)
+{
+    clearLoopRegion();
+    overview.reset();
+    overviewNeedsRedraw = true;
+    playheadSeconds = 0.0;
+    settingsPending = false;
+
+    builder.build(file, settings);
+    repaint();
+}
+
+void OverviewStrip::setRideSettings(const RideSettings& settings)
+{
+    if (!hasFile())
+        return;
+
+    if (!settingsPending || settings != pendingSettings)
+    {
+        pendingSettings = settings;
+        settingsPending = true;
+        settingsStableTicks = 0;
+    }
+}
+
+void OverviewStrip::setPlayheadPosition(double seconds)
+{
+    if (std::abs(seconds - playheadSeconds) < 1.0e-4)
+        return;
+
+    auto oldX = secondsToX(playheadSeconds);
+    playheadSeconds = seconds;
+    auto newX = secondsToX(playheadSeconds);
+
+    // Only repaint the columns the playhead moved across
+    repaint(juce::Rectangle<float>(juce::jmin(oldX, newX) - 2.0f, 0.0f,
+                                   std::abs(newX - oldX) + 4.0f, static_cast<float>(getHeight()))
+                .getSmallestIntegerContainer());
+}
+
+void OverviewStrip::setLoopRegion(double startSeconds, double endSeconds)
+{
+    if (startSeconds == loopStartSeconds && endSeconds == loopEndSeconds)
+        return;
+
+    loopStartSeconds = startSeconds;
+    loopEndSeconds = endSeconds;
+    rebuildLoopGainPath();
+    repaint();
+}
+
+void OverviewStrip::clearLoopRegion()
+{
+    loopStartSeconds = loopEndSeconds = -1.0;
+    loopRender.reset();
+    loopGainPath.clear();
+    repaint();
+}
+
+void OverviewStrip::setLoopRender(std::shared_ptr<const LoopRender> render)
+{
+    if (render == loopRender)
+        return;
+
+    loopRender = std::move(render);
+    rebuildLoopGainPath();
+    repaint();
+}
+
+void OverviewStrip::rebuildLoopGainPath()
+{
+    loopGainPath.clear();
+
+    // Only draw a render that belongs to the region currently shown
+    if (loopRender == nullptr || !loopRender->hasGain() || overview == nullptr
+        || loopRender->startSeconds != loopStartSeconds || loopRender->endSeconds != loopEndSeconds)
+        return;
+
+    const float x0 = secondsToX(loopRender->startSeconds);
+    const float x1 = secondsToX(loopRender->endSeconds);
+    const int numColumns = juce::jmax(1, juce::roundToInt(x1 - x0));
+    const auto& gains = loopRender->gainDb;
+    const auto numGains = static_cast<juce::int64>(gains.size());
+
+    const float centreY = getHeight() * 0.5f;
+    const float halfHeight = getHeight() * 0.5f - 2.0f;
+
+    for (int column = 0; column < numColumns; ++column)
+    {
+        // Mean gain of the samples under this pixel column
+        auto g0 = static_cast<size_t>(column * numGains / numColumns);
+        auto g1 = static_cast<size_t>(juce::jmax(static_cast<juce::int64>(g0) + 1, (column + 1) * numGains / numColumns));
+        g1 = juce::jmin(g1, gains.size());
+
+        double sum = 0.0;
+        for (auto i = g0; i < g1; ++i)
+            sum += gains[i];
+
+        float gainDb = juce::jlimit(-gainDisplayRangeDb, gainDisplayRangeDb,
+                                    static_cast<float>(sum / static_cast<double>(juce::jmax<size_t>(1, g1 - g0))));
+        float x = x0 + static_cast<float>(column);
+        float y = centreY - (gainDb / gainDisplayRangeDb) * halfHeight;
+
+        if (column == 0)
+            loopGainPath.startNewSubPath(x, y);
+        else
+            loopGainPath.lineTo(x, y);
+    }
+}
+
+void OverviewStrip::timerCallback()
+{
+    if (settingsPending && ++settingsStableTicks >= settingsDebounceTicks)
+    {
+        settingsPending = false;
+        builder.updateRideSettings(pendingSettings);
+    }
+
+    if (builder.isBuilding())
+        repaint();
+}
+
+//==============================================================================
+void OverviewStrip::resized()
+{
+    overviewNeedsRedraw = true;
+    rebuildLoopGainPath();
+}
+
+void OverviewStrip::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (overviewNeedsRedraw || pixelScale != cachedOverviewScale)
+    {
+        cachedOverviewScale = pixelScale;
+        renderCachedOverview();
+        overviewNeedsRedraw = false;
+    }
+
+    if (cachedOverviewImage.isValid())
+        g.drawImageTransformed(cachedOverviewImage, juce::AffineTransform::scale(1.0f / cachedOverviewScale));
+    else
+        g.fillAll(CustomLookAndFeel::getSurfaceDarkColour());
+
+    // Analysis progress (shown over the previous overview while re-rendering)
+    if (builder.isBuilding())
+    {
+        float progress = juce::jlimit(0.0f, 1.0f, builder.getProgress());
+        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.6f));
+        g.fillRect(bounds.withHeight(2.0f).withWidth(bounds.getWidth() * progress));
+
+        if (overview == nullptr)
+        {
+            g.setColour(CustomLookAndFeel::getDimTextColour());
+            g.setFont(CustomLookAndFeel::getPluginFont(10.0f));
+            g.drawText("Analysing " + juce::String(juce::roundToInt(progress * 100.0f)) + "%",
+                       bounds, juce::Justification::centred);
+        }
+    }
+
+    // Loop region with its latest rendered ride
+    if (overview != nullptr && loopEndSeconds > loopStartSeconds)
+    {
+        const float x0 = secondsToX(loopStartSeconds);
+        const float x1 = secondsToX(loopEndSeconds);
+        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.12f));
+        g.fillRect(x0, 0.0f, x1 - x0, bounds.getHeight());
+        g.setColour(CustomLookAndFeel::getAccentColour().withAlpha(0.7f));
+        g.fillRect(x0, 0.0f, 1.0f, bounds.getHeight());
+        g.fillRect(x1 - 1.0f, 0.0f, 1.0f, bounds.getHeight());
+
+        if (!loopGainPath.isEmpty())
+        {
+            g.setColour(CustomLookAndFeel::getTextColour());
+            g.strokePath(loopGainPath, juce::PathStrokeType(1.5f, juce::PathStrokeType::curved));
+        }
+    }
+
+    // Playhead
+    if (overview != nullptr)
+    {
+        float x = secondsToX(playheadSeconds);
+        g.setColour(CustomLookAndFeel::getTextColour().withAlpha(0.85f));
+        g.fillRect(x - 0.5f, 0.0f, 1.0f, bounds.getHeight());
+    }
+}
+
+void OverviewStrip::renderCachedOverview()
+{
+    const int width = getWidth();
+    const int height = getHeight();
+    if (width <= 0 || height <= 0)
+    {
+        cachedOverviewImage = {};
+        return;
+    }
+
+    cachedOverviewImage = juce::Image(juce::Image::RGB,
+                                      juce::roundToInt(static_cast<float>(width) * cachedOverviewScale),
+                                      juce::roundToInt(static_cast<float>(height) * cachedOverviewScale),
+                                      true);
+    juce::Graphics g(cachedOverviewImage);
+    g.addTransform(juce::AffineTransform::scale(cachedOverviewScale));
+
+    g.fillAll(CustomLookAndFeel::getSurfaceDarkColour());
+
+    if (overview == nullptr || overview->getNumBuckets() == 0)
+        return;
+
+    const int numBuckets = overview->getNumBuckets();
+    const float centreY = height * 0.5f;
+    const float halfHeight = height * 0.5f - 2.0f;
+
+    // Normalise to the file's peak so quiet takes are still readable
+    float filePeak = 1.0e-6f;
+    for (int i = 0; i < numBuckets; ++i)
+    {
+        filePeak = juce::jmax(filePeak, std::abs(overview->minValues[static_cast<size_t>(i)]),
+                              std::abs(overview->maxValues[static_cast<size_t>(i)]));
+    }
+    const float amplitudeScale = halfHeight / filePeak;
+
+    const bool hasRide = static_cast<int>(overview->rideGainDb.size()) == numBuckets;
+    juce::Path gainPath;
+
+    for (int x = 0; x < width; ++x)
+    {
+        // Merge the buckets that fall into this pixel column
+        int b0 = static_cast<int>(static_cast<juce::int64>(x) * numBuckets / width);
+        int b1 = juce::jmax(b0 + 1, static_cast<int>(static_cast<juce::int64>(x + 1) * numBuckets / width));
+        b1 = juce::jmin(b1, numBuckets);
+
+        float minV = 0.0f, maxV = 0.0f, gainSum = 0.0f;
+        double sumSquares = 0.0;
+        for (int b = b0; b < b1; ++b)
+        {
+            auto idx = static_cast<size_t>(b);
+            minV = juce::jmin(minV, overview->minValues[idx]);
+            maxV = juce::jmax(maxV, overview->maxValues[idx]);
+            sumSquares += static_cast<double>(overview->rmsValues[idx]) * overview->rmsValues[idx];
+            if (hasRide)
+                gainSum += overview->rideGainDb[idx];
+        }
+        const int count = b1 - b0;
+        const float rms = static_cast<float>(std::sqrt(sumSquares / juce::jmax(1, count)));
+
+        // Min/max envelope
+        g.setColour(CustomLookAndFeel::getWaveformDimColour());
+        g.fillRect(static_cast<float>(x), centreY - maxV * amplitudeScale,
+                   1.0f, juce::jmax(1.0f, (maxV - minV) * amplitudeScale));
+
+        // RMS body
+        g.setColour(CustomLookAndFeel::getWaveformColour().withAlpha(0.55f));
+        g.fillRect(static_cast<float>(x), centreY - rms * amplitudeScale,
+                   1.0f, juce::jmax(1.0f, 2.0f * rms * amplitudeScale));
+
+        if (hasRide && count > 0)
+        {
+            float gainDb = juce::jlimit(-gainDisplayRangeDb, gainDisplayRangeDb, gainSum / static_cast<float>(count));
+            float y = centreY - (gainDb / gainDisplayRangeDb) * halfHeight;
+            if (x == 0)
+                gainPath.startNewSubPath(0.0f, y);
+            else
+                gainPath.lineTo(static_cast<float>(x), y);
+        }
+    }
+
+    // 0 dB reference and ride preview
+    g.setColour(CustomLookAndFeel::getRangeLineColour().withAlpha(0.5f));
+    g.drawHorizontalLine(static_cast<int>(centreY), 0.0f, static_cast<float>(width));
+
+    if (!gainPath.isEmpty())
+    {
+        g.setColour(CustomLookAndFeel::getAccentColour());
+        g.strokePath(gainPath, juce::PathStrokeType(1.2f, juce::PathStrokeType::curved));
+    }
+
+    // Top border separating the strip from the waveform above
+    g.setColour(CustomLookAndFeel::getBorderColour());
+    g.drawHorizontalLine(0, 0.0f, static_cast<float>(width));
+}
+
+//==============================================================================
+double OverviewStrip::xToSeconds(float x) const
+{
+    if (overview == nullptr || getWidth() <= 0)
+        return 0.0;
+    return juce::jlimit(0.0, 1.0, static_cast<double>(x) / getWidth()) * overview->getLengthInSeconds();
+}
+
+float OverviewStrip::secondsToX(double seconds) const
+{
+    if (overview == nullptr || overview->getLengthInSeconds() <= 0.0)
+        return 0.0f;
+    return static_cast<float>(seconds / overview->getLengthInSeconds() * getWidth());
+}
+
+void OverviewStrip::mouseDown(const juce::MouseEvent& event)
+{
+    if (overview == nullptr)
+        return;
+
+    // Shift-drag marks a loop region
+    if (event.mods.isShiftDown())
+    {
+        selectingLoop = true;
+        loopAnchorSeconds = xToSeconds(event.position.x);
+        return;
+    }
+
+    if (onSeek)
+        onSeek(xToSeconds(event.position.x));
+}
+
+void OverviewStrip::mouseDrag(const juce::MouseEvent& event)
+{
+    if (overview == nullptr)
+        return;
+
+    if (selectingLoop)
+    {
+        double seconds = xToSeconds(event.position.x);
+        setLoopRegion(juce::jmin(loopAnchorSeconds, seconds), juce::jmax(loopAnchorSeconds, seconds));
+        return;
+    }
+
+    if (onSeek)
+        onSeek(xToSeconds(event.position.x));
+}
+
+void OverviewStrip::mouseUp(const juce::MouseEvent& event)
+{
+    if (!selectingLoop)
+        return;
+
+    selectingLoop = false;
+
+    // A shift-click without a drag clears the loop
+    if (std::abs(event.getDistanceFromDragStartX()) < 3 || loopEndSeconds <= loopStartSeconds)
+    {
+        clearLoopRegion();
+        if (onLoopCleared)
+            onLoopCleared();
+        return;
+    }
+
+    if (onLoopRegionChanged)
+        onLoopRegionChanged(loopStartSeconds, loopEndSeconds);
+}
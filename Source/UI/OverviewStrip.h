@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    OverviewStrip.h
+    Created: 2026
+    Author:  MBM Audio
+
+    Whole-file overview for the Standalone player:
+    - Min/max/RMS per pixel of the loaded file
+    - Pre-computed ride preview (gain curve) for the current settings
+    - Progress while the background analysis runs, click to seek
+    - Shift-drag marks a loop region, drawn with its latest rendered ride
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include "../IO/OverviewBuilder.h"
+#include "../IO/LoopRenderer.h"
+
+class OverviewStrip : public juce::Component,
+                      public juce::Timer
+{
+public:
+    OverviewStrip();
+    ~OverviewStrip() override;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void timerCallback() override;
+
+    void mouseDown(const juce::MouseEvent& event) override;
+    void mouseDrag(const juce::MouseEvent& event) override;
+    void mouseUp(const juce::MouseEvent& event) override;
+
+    //==============================================================================
+    /** Starts analysing a newly loaded file */
+    void loadFile(const juce::File& file, const RideSettings& settings);
+
+    /** Re-renders the ride preview once the settings have been stable for a moment */
+    void setRideSettings(const RideSettings& settings);
+
+    void setPlayheadPosition(double seconds);
+
+    bool hasFile() const { return builder.getFile() != juce::File(); }
+
+    /** Loop region to highlight (seconds); clearLoopRegion() removes it */
+    void setLoopRegion(double startSeconds, double endSeconds);
+    void clearLoopRegion();
+
+    /** Shows a finished loop render's gain curve over the region */
+    void setLoopRender(std::shared_ptr<const LoopRender> render);
+
+    /** Called with the clicked position in seconds */
+    std::function<void(double)> onSeek;
+
+    /** Called when the user shift-drags a loop region / shift-clicks to clear it */
+    std::function<void(double, double)> onLoopRegionChanged;
+    std::function<void()> onLoopCleared;
+
+private:
+    //==============================================================================
+    void renderCachedOverview();
+    void rebuildLoopGainPath();
+    double xToSeconds(float x) const;
+    float secondsToX(double seconds) const;
+
+    //==============================================================================
+    OverviewBuilder builder;
+    std::shared_ptr<const OverviewData> overview;
+
+    juce::Image cachedOverviewImage;
+    bool overviewNeedsRedraw = true;
+    float cachedOverviewScale = 1.0f;   // Rendered at device resolution, blitted 1:1
+
+    double playheadSeconds = 0.0;
+
+    // Loop region (negative = none) and the gain curve of its latest render
+    double loopStartSeconds = -1.0;
+    double loopEndSeconds = -1.0;
+    std::shared_ptr<const LoopRender> loopRender;
+    juce::Path loopGainPath;
+
+    bool selectingLoop = false;
+    double loopAnchorSeconds = 0.0;
+
+    // Debounced ride preview refresh (settings change while dragging knobs)
+    RideSettings pendingSettings;
+    bool settingsPending = false;
+    int settingsStableTicks = 0;
+    static constexpr int settingsDebounceTicks = 12;  // ~400ms at 30Hz
+
+    static constexpr float gainDisplayRangeDb = 12.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OverviewStrip)
+};
@@ -19,8 +19,11 @@ WaveformDisplay::WaveformDisplay()
 {
     lastFrameTime = juce::Time::getMillisecondCounterHiRes() / 1000.0;
     
+    // The background layer covers every pixel, so 30 Hz repaints never pull in the editor
+    setOpaque(true);
+    
     // Pre-allocate pendingData to avoid heap allocation on the audio thread
-    pendingData.reserve(2048);
+    pendingData.reserve(static_cast<size_t>(pendingCapacity));
     
     addAndMakeVisible(zoomButton);
     zoomButton.setToggled(adaptiveZoomEnabled);
@@ -42,6 +45,17 @@ WaveformDisplay::WaveformDisplay()
         }
     };
     
+    // Background renders after a resize replace the stretched placeholders
+    layerRenderer.onLayerReady = [this](int layerId, const CachedLayer& layer)
+    {
+        if (layerId == backgroundLayer)
+            cachedBackgroundImage = layer;
+        else if (layerId == staticOverlayLayer)
+            cachedStaticOverlay = layer;
+        
+        repaint();
+    };
+    
     startTimerHz(30);
 }
 
@@ -72,9 +86,7 @@ void WaveformDisplay::resized()
         zoomSize, zoomSize);
     zoomButton.toFront(false);
     
-    // Mark cached images for regeneration
-    backgroundNeedsRedraw = true;
-    staticOverlayNeedsRedraw = true;
+    // Cached layers notice the new size in paint() and re-render in the background
 }
 
 void WaveformDisplay::initializeWaveformImage()
@@ -92,32 +104,36 @@ void WaveformDisplay::initializeWaveformImage()
         waveformImage = juce::Image(juce::Image::ARGB, imageWidth, imageHeight, true);
         waveformImage.clear(waveformImage.getBounds(), juce::Colours::transparentBlack);
         
-        // Initialize gain curve buffer (one value per pixel)
-        // Use assign to clear ALL values when resizing (not just new elements)
-        gainCurveBuffer.assign(static_cast<size_t>(imageWidth), 0.0f);
-        gainCurveWriteIndex = 0;
+        // Keep the newest columns of history (right-aligned, so what's on screen
+        // stays put while the window is dragged) and drop or pad the oldest
+        auto keepNewest = [newSize = static_cast<size_t>(imageWidth)](auto& buffer, auto fillValue)
+        {
+            const size_t oldSize = buffer.size();
+            if (newSize < oldSize)
+                buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(oldSize - newSize));
+            else if (newSize > oldSize)
+                buffer.insert(buffer.begin(), newSize - oldSize, fillValue);
+        };
         
-        // Initialize position buffers for closed path rendering
-        // Use assign to ensure ALL values are reset when window size changes
+        // Raw data history for rebuilding on zoom changes
+        keepNewest(columnRawData, SampleData{});
+        
+        // Sidechain trace buffer
+        keepNewest(sidechainTraceBuffer, -100.0f);
+        
+        // Gain curve buffer and position buffers for closed path rendering
+        // (one value per pixel) are rebuilt from the raw history for the new height
         float defaultY = static_cast<float>(imageHeight);  // Bottom = no signal
+        gainCurveBuffer.assign(static_cast<size_t>(imageWidth), 0.0f);
         inputTopBuffer.assign(static_cast<size_t>(imageWidth), defaultY);
         inputBottomBuffer.assign(static_cast<size_t>(imageWidth), defaultY);
         outputTopBuffer.assign(static_cast<size_t>(imageWidth), defaultY);
         outputBottomBuffer.assign(static_cast<size_t>(imageWidth), defaultY);
+        gainCurveWriteIndex = 0;
+        rebuildWaveformFromRawData();
         
-        // Raw data history for rebuilding on zoom changes
-        columnRawData.assign(static_cast<size_t>(imageWidth), SampleData{});
-        
-        // Sidechain trace buffer
-        sidechainTraceBuffer.assign(static_cast<size_t>(imageWidth), -100.0f);
-        
-        // Reset scroll state
+        // Columns keep scrolling in from the pending queue as before
         scrollAccumulator = 0.0;
-        
-        // Clear pending data
-        juce::SpinLock::ScopedLockType lock(pendingLock);
-        pendingData.clear();
-        pendingReadIndex = 0;
     }
 }
 
@@ -464,6 +480,7 @@ void WaveformDisplay::clear()
     isClipping = false;
     hasLastDrawnData = false;
     lastDrawnData = SampleData();
+    columnsSinceAudio = 0;
     {
         juce::SpinLock::ScopedLockType lock(pendingLock);
         pendingData.clear();
@@ -475,6 +492,12 @@ void WaveformDisplay::clear()
 //==============================================================================
 // Audio data input
 
+std::pair<int, int> WaveformDisplay::getPendingQueueSize() const
+{
+    juce::SpinLock::ScopedLockType lock(pendingLock);
+    return { static_cast<int>(pendingData.size()), static_cast<int>(pendingData.capacity()) };
+}
+
 void WaveformDisplay::pushSamples(const float* inputSamples, const float* outputSamples,
                                    const float* gainValues, int numSamples)
 {
@@ -541,6 +564,13 @@ void WaveformDisplay::pushSamples(const float* inputSamples, const float* output
                     pendingData.clear();
                     pendingReadIndex = 0;
                 }
+                // Compact here too: if the message thread stalls, timerCallback never
+                // does, and the queue would outgrow its reserve (allocating on this thread)
+                else if (pendingReadIndex > pendingCapacity / 2)
+                {
+                    pendingData.erase(pendingData.begin(), pendingData.begin() + pendingReadIndex);
+                    pendingReadIndex = 0;
+                }
             }
 
             sampleCounter = 0;
@@ -756,6 +786,52 @@ void WaveformDisplay::rebuildWaveformFromRawData()
     }
 }
 
+void WaveformDisplay::applyGainPreview(const std::vector<float>& gainDb, double pointsPerSecond, double ageSeconds)
+{
+    if (imageWidth <= 0 || columnRawData.empty() || gainDb.empty() || pointsPerSecond <= 0.0)
+        return;
+    
+    const double pointsPerColumn = pointsPerSecond / static_cast<double>(pixelsPerSecondFixed);
+    const auto numPoints = static_cast<int>(gainDb.size());
+    
+    // Points between the preview's newest point and the newest column
+    const int agePoints = juce::jmax(0, juce::roundToInt(ageSeconds * pointsPerSecond));
+    bool changed = false;
+    
+    for (int x = imageWidth - 1 - columnsSinceAudio; x >= 0; --x)
+    {
+        // Column's span in preview points, counted back from the newest
+        const int columnsAgo = imageWidth - 1 - columnsSinceAudio - x;
+        const int newestPoint = numPoints - 1 + agePoints - static_cast<int>(columnsAgo * pointsPerColumn);
+        const int first = juce::jmax(0, newestPoint - juce::jmax(1, static_cast<int>(pointsPerColumn)) + 1);
+        const int last = juce::jmin(numPoints - 1, newestPoint);
+        if (newestPoint < 0)
+            break;
+        if (first > last)
+            continue;   // Arrived after the preview was taken
+        
+        auto& data = columnRawData[static_cast<size_t>(x)];
+        if (data.inputRms <= 0.0001f)
+            continue;   // Nothing was riding here
+        
+        float sum = 0.0f;
+        for (int i = first; i <= last; ++i)
+            sum += gainDb[static_cast<size_t>(i)];
+        const float newGainDb = sum / static_cast<float>(last - first + 1);
+        
+        // Output follows the gain difference, so trim and clipping stay as recorded
+        data.outputRms *= juce::Decibels::decibelsToGain(newGainDb - data.gainDb);
+        data.gainDb = newGainDb;
+        changed = true;
+    }
+    
+    if (changed)
+    {
+        rebuildWaveformFromRawData();
+        repaint();
+    }
+}
+
 void WaveformDisplay::drawGainCurvePath(juce::Graphics& g)
 {
     if (gainCurveBuffer.empty() || imageWidth <= 0) return;
@@ -1257,6 +1333,11 @@ void WaveformDisplay::timerCallback()
         {
             lastDrawnData = frameData.back();
             hasLastDrawnData = true;
+            columnsSinceAudio = 0;
+        }
+        else
+        {
+            columnsSinceAudio += pixelsToScroll;
         }
     }
     
@@ -1285,17 +1366,31 @@ void WaveformDisplay::timerCallback()
 
 void WaveformDisplay::paint(juce::Graphics& g)
 {
-    drawBackground(g);
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    
+    drawBackground(g, pixelScale);
     
     if (waveformImage.isNull())
         return;
     
-    // Use cached static overlay (grid + target/range lines - regenerated when params change)
+    // Use cached static overlay (grid + target/range lines). New content is
+    // rendered right away so it lines up with the waveform; a new size alone
+    // is re-rendered in the background.
+    const auto bounds = getLocalBounds();
+    auto overlayPainter = [state = getOverlayState()](juce::Graphics& lg) { paintStaticOverlay(lg, state); };
+    
     if (staticOverlayNeedsRedraw || cachedStaticOverlay.isNull())
-        renderCachedStaticOverlay();
+    {
+        layerRenderer.cancel(staticOverlayLayer);
+        cachedStaticOverlay = LayerRenderer::render(bounds, pixelScale, overlayPainter);
+        staticOverlayNeedsRedraw = false;
+    }
+    else if (!cachedStaticOverlay.matches(bounds, pixelScale))
+    {
+        layerRenderer.request(staticOverlayLayer, bounds, pixelScale, overlayPainter);
+    }
     
-    if (!cachedStaticOverlay.isNull())
-        g.drawImageAt(cachedStaticOverlay, 0, 0);
+    cachedStaticOverlay.draw(g, bounds);
     
     // Draw Natural Mode phrase indicator (dynamic - changes per frame)
     if (naturalModeActive)
@@ -1329,14 +1424,8 @@ void WaveformDisplay::paint(juce::Graphics& g)
 //==============================================================================
 // Cached rendering
 
-void WaveformDisplay::renderCachedBackground()
+void WaveformDisplay::paintBackgroundLayer(juce::Graphics& g, juce::Rectangle<int> bounds)
 {
-    auto bounds = getLocalBounds();
-    if (bounds.isEmpty()) return;
-    
-    cachedBackgroundImage = juce::Image(juce::Image::ARGB, bounds.getWidth(), bounds.getHeight(), true);
-    juce::Graphics g(cachedBackgroundImage);
-    
     auto boundsF = bounds.toFloat();
     
     g.setColour(juce::Colour(0xFF252830));
@@ -1382,62 +1471,80 @@ void WaveformDisplay::renderCachedBackground()
     );
     g.setGradientFill(rightVig);
     g.fillRect(boundsF.getRight() - vignetteWidth, boundsF.getY(), vignetteWidth, boundsF.getHeight());
-    
-    backgroundNeedsRedraw = false;
 }
 
-void WaveformDisplay::renderCachedStaticOverlay()
+void WaveformDisplay::paintStaticOverlay(juce::Graphics& g, const OverlayState& state)
 {
-    auto bounds = getLocalBounds();
-    if (bounds.isEmpty()) return;
-    
-    cachedStaticOverlay = juce::Image(juce::Image::ARGB, bounds.getWidth(), bounds.getHeight(), true);
-    juce::Graphics g(cachedStaticOverlay);
-    
-    drawGridLines(g);
-    drawTargetAndRangeLines(g);
-    
-    staticOverlayNeedsRedraw = false;
+    drawGridLines(g, state);
+    drawTargetAndRangeLines(g, state);
+}
+
+WaveformDisplay::OverlayState WaveformDisplay::getOverlayState() const
+{
+    OverlayState state;
+    state.waveformArea = waveformArea;
+    state.displayFloor = displayFloor;
+    state.displayCeiling = displayCeiling;
+    state.targetDb = targetLevelDb.load();
+    state.boostDb = boostRangeDb.load();
+    state.cutDb = cutRangeDb.load();
+    state.noiseFloorDb = noiseFloorDb.load();
+    state.noiseFloorActive = noiseFloorActive.load();
+    return state;
+}
+
+float WaveformDisplay::OverlayState::dbToY(float db) const
+{
+    float range = displayCeiling - displayFloor;
+    if (range < 1.0f) range = 1.0f;
+    float normalized = (db - displayFloor) / range;
+    normalized = juce::jlimit(0.0f, 1.0f, normalized);
+    return waveformArea.getBottom() - normalized * waveformArea.getHeight();
 }
 
 //==============================================================================
 // Static drawing functions
 
-void WaveformDisplay::drawBackground(juce::Graphics& g)
+void WaveformDisplay::drawBackground(juce::Graphics& g, float pixelScale)
 {
-    // Use cached background image (regenerated only on resize)
-    if (backgroundNeedsRedraw || cachedBackgroundImage.isNull())
-        renderCachedBackground();
+    // Use cached background image (only depends on size; the first render is
+    // synchronous, later sizes come from the background renderer)
+    const auto bounds = getLocalBounds();
+    auto backgroundPainter = [bounds](juce::Graphics& lg) { paintBackgroundLayer(lg, bounds); };
+    
+    if (cachedBackgroundImage.isNull())
+        cachedBackgroundImage = LayerRenderer::render(bounds, pixelScale, backgroundPainter);
+    else if (!cachedBackgroundImage.matches(bounds, pixelScale))
+        layerRenderer.request(backgroundLayer, bounds, pixelScale, backgroundPainter);
     
-    if (!cachedBackgroundImage.isNull())
-        g.drawImageAt(cachedBackgroundImage, 0, 0);
+    cachedBackgroundImage.draw(g, bounds);
 }
 
-void WaveformDisplay::drawGridLines(juce::Graphics& g)
+void WaveformDisplay::drawGridLines(juce::Graphics& g, const OverlayState& state)
 {
-    if (waveformArea.isEmpty()) return;
+    if (state.waveformArea.isEmpty()) return;
     
     // Dynamic grid lines based on current adaptive display range
     float step = 6.0f;
-    float range = displayCeiling - displayFloor;
+    float range = state.displayCeiling - state.displayFloor;
     if (range > 50.0f) step = 12.0f;
     else if (range > 30.0f) step = 6.0f;
     else step = 3.0f;
     
-    float firstLine = std::ceil(displayFloor / step) * step;
+    float firstLine = std::ceil(state.displayFloor / step) * step;
     
-    float labelX = waveformArea.getRight() - 32.0f;
+    float labelX = state.waveformArea.getRight() - 32.0f;
     g.setFont(CustomLookAndFeel::getPluginFont(11.0f, false));
     
-    for (float db = firstLine; db <= displayCeiling; db += step)
+    for (float db = firstLine; db <= state.displayCeiling; db += step)
     {
-        float y = dbToY(db);
+        float y = state.dbToY(db);
         
         // Major lines at 0, -6, -12, -18 (or multiples of 12 for large ranges)
         bool isMajor = (std::fmod(std::abs(db), 6.0f) < 0.1f);
         
         g.setColour(juce::Colour(0xFF3A3F4B).withAlpha(isMajor ? 0.6f : 0.3f));
-        g.drawHorizontalLine(static_cast<int>(y), waveformArea.getX(), waveformArea.getRight());
+        g.drawHorizontalLine(static_cast<int>(y), state.waveformArea.getX(), state.waveformArea.getRight());
         
         // Labels
         if (isMajor)
@@ -1450,54 +1557,54 @@ void WaveformDisplay::drawGridLines(juce::Graphics& g)
     }
 }
 
-void WaveformDisplay::drawTargetAndRangeLines(juce::Graphics& g)
+void WaveformDisplay::drawTargetAndRangeLines(juce::Graphics& g, const OverlayState& state)
 {
-    float target = targetLevelDb.load();
-    float boost = boostRangeDb.load();
-    float cut = cutRangeDb.load();
+    float target = state.targetDb;
+    float boost = state.boostDb;
+    float cut = state.cutDb;
     
-    float targetY = dbToY(target);
-    float boostY = dbToY(target + boost);
-    float cutY = dbToY(target - cut);
+    float targetY = state.dbToY(target);
+    float boostY = state.dbToY(target + boost);
+    float cutY = state.dbToY(target - cut);
     
     juce::Colour rangeColour(0xFF888899);
     
     juce::Colour targetPurpleDark(0xFF9060D0);
     juce::Colour targetPurpleLight(0xFFD0A0FF);
     
-    float lineRightEdge = waveformArea.getRight() - 2.0f;
-    float lineWidth = lineRightEdge - waveformArea.getX();
+    float lineRightEdge = state.waveformArea.getRight() - 2.0f;
+    float lineWidth = lineRightEdge - state.waveformArea.getX();
     
     // Range fill (subtle gray)
     g.setColour(rangeColour.withAlpha(0.04f));
-    g.fillRect(waveformArea.getX(), boostY, lineWidth, cutY - boostY);
+    g.fillRect(state.waveformArea.getX(), boostY, lineWidth, cutY - boostY);
     
     float dashLengths[] = { 6.0f, 4.0f };
     
     // Boost range line - DASHED GRAY
     g.setColour(rangeColour.withAlpha(0.6f));
-    g.drawDashedLine(juce::Line<float>(waveformArea.getX(), boostY, lineRightEdge, boostY),
+    g.drawDashedLine(juce::Line<float>(state.waveformArea.getX(), boostY, lineRightEdge, boostY),
                      dashLengths, 2, 1.0f);
     
     // Cut range line - DASHED GRAY
     g.setColour(rangeColour.withAlpha(0.6f));
-    g.drawDashedLine(juce::Line<float>(waveformArea.getX(), cutY, lineRightEdge, cutY),
+    g.drawDashedLine(juce::Line<float>(state.waveformArea.getX(), cutY, lineRightEdge, cutY),
                      dashLengths, 2, 1.0f);
     
     // Target line - GRADIENT (purple to light purple)
     {
         juce::ColourGradient targetGrad(
-            targetPurpleDark, waveformArea.getX(), targetY,
+            targetPurpleDark, state.waveformArea.getX(), targetY,
             targetPurpleLight, lineRightEdge, targetY,
             false
         );
         g.setGradientFill(targetGrad);
-        g.fillRect(waveformArea.getX(), targetY - 1.0f, lineWidth, 2.0f);
+        g.fillRect(state.waveformArea.getX(), targetY - 1.0f, lineWidth, 2.0f);
     }
     
     // === LEFT SIDE LABELS - ABOVE their lines ===
     g.setFont(CustomLookAndFeel::getPluginFont(14.0f, true));
-    float labelX = waveformArea.getX() + 6.0f;
+    float labelX = state.waveformArea.getX() + 6.0f;
     
     // Target label - ABOVE the target line
     g.setColour(targetPurpleLight.withAlpha(0.95f));
@@ -1515,24 +1622,24 @@ void WaveformDisplay::drawTargetAndRangeLines(juce::Graphics& g)
     g.drawText(cutLabel, static_cast<int>(labelX), static_cast<int>(cutY - 22), 70, 18, juce::Justification::left);
     
     // === NOISE FLOOR LINE ===
-    if (noiseFloorActive)
+    if (state.noiseFloorActive)
     {
-        float nfDb = noiseFloorDb.load();
+        float nfDb = state.noiseFloorDb;
         if (nfDb > -59.9f)  // Only draw when active (above minimum)
         {
-            float nfY = dbToY(nfDb);
+            float nfY = state.dbToY(nfDb);
             
             // Red color for noise floor (represents rejection)
             juce::Colour nfColour(0xFFC04040);
             
             // Semi-transparent fill below the noise floor line (to show "dead zone")
             g.setColour(nfColour.withAlpha(0.06f));
-            g.fillRect(waveformArea.getX(), nfY, lineWidth, waveformArea.getBottom() - nfY);
+            g.fillRect(state.waveformArea.getX(), nfY, lineWidth, state.waveformArea.getBottom() - nfY);
             
             // Dashed line at noise floor level
             float nfDashLengths[] = { 4.0f, 3.0f };
             g.setColour(nfColour.withAlpha(0.7f));
-            g.drawDashedLine(juce::Line<float>(waveformArea.getX(), nfY, lineRightEdge, nfY),
+            g.drawDashedLine(juce::Line<float>(state.waveformArea.getX(), nfY, lineRightEdge, nfY),
                              nfDashLengths, 2, 1.0f);
             
             // Label - just "NF", positioned below the line
@@ -18,8 +18,10 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <vector>
+#include <utility>
 #include <atomic>
 #include <functional>
+#include "LayerRenderer.h"
 
 class WaveformDisplay : public juce::Component,
                         public juce::Timer
@@ -43,6 +45,16 @@ public:
     void pushSamples(const float* inputSamples, const float* outputSamples, 
                      const float* gainValues, int numSamples);
     void clear();
+    
+    /** Entries held in the column queue (read or not) and its reserved capacity */
+    std::pair<int, int> getPendingQueueSize() const;
+    
+    /** Replaces the gain (and derived output) of the columns already on screen
+        with a re-rendered ride. gainDb is evenly spaced at pointsPerSecond and
+        ends ageSeconds before the newest audio pushed (the audio that arrived
+        while it rendered); the newest columns keep their live gain.
+    */
+    void applyGainPreview(const std::vector<float>& gainDb, double pointsPerSecond, double ageSeconds);
 
     //==============================================================================
     // Target and Range control (separate boost/cut)
@@ -136,6 +148,23 @@ private:
         float gainDb = 0.0f;        // Average gain adjustment in dB
     };
 
+    // Everything the static overlay depends on, copied so it can be drawn off
+    // the message thread
+    struct OverlayState
+    {
+        juce::Rectangle<float> waveformArea;
+        float displayFloor = -64.0f;
+        float displayCeiling = 6.0f;
+        float targetDb = -18.0f;
+        float boostDb = 12.0f;
+        float cutDb = 12.0f;
+        float noiseFloorDb = -100.0f;
+        bool noiseFloorActive = false;
+        
+        float dbToY(float db) const;
+    };
+    OverlayState getOverlayState() const;
+
     // Coordinate conversions (logarithmic scale)
     float linearToLogY(float linear, float areaHeight) const;
     float dbToY(float db) const;
@@ -148,9 +177,9 @@ private:
     DragTarget hitTestHandle(const juce::Point<float>& pos) const;
     
     // Drawing helpers (static elements drawn each frame)
-    void drawBackground(juce::Graphics& g);
-    void drawGridLines(juce::Graphics& g);
-    void drawTargetAndRangeLines(juce::Graphics& g);
+    void drawBackground(juce::Graphics& g, float pixelScale);
+    static void drawGridLines(juce::Graphics& g, const OverlayState& state);
+    static void drawTargetAndRangeLines(juce::Graphics& g, const OverlayState& state);
     void drawHandles(juce::Graphics& g);
     void drawIOMeters(juce::Graphics& g);
     void drawClippingIndicator(juce::Graphics& g);
@@ -164,15 +193,21 @@ private:
     void drawGainCurvePath(juce::Graphics& g);  // Draw smooth gain curve as path
 
     //==============================================================================
-    // Cached background image (noise texture + vignette - only regenerated on resize)
-    juce::Image cachedBackgroundImage;
-    bool backgroundNeedsRedraw = true;
-    void renderCachedBackground();
+    // Cached background image (noise texture + vignette - only depends on size)
+    CachedLayer cachedBackgroundImage;
+    static void paintBackgroundLayer(juce::Graphics& g, juce::Rectangle<int> bounds);
     
     // Cached static overlay (grid lines, target/range lines - regenerated when params change)
-    juce::Image cachedStaticOverlay;
+    CachedLayer cachedStaticOverlay;
     bool staticOverlayNeedsRedraw = true;
-    void renderCachedStaticOverlay();
+    static void paintStaticOverlay(juce::Graphics& g, const OverlayState& state);
+    
+    // Both cached layers are rendered at device resolution (display scale x editor
+    // scale transform) so blitting them each frame never resamples. After a resize
+    // they are re-rendered in the background; the old images are stretched over
+    // the new bounds until then.
+    enum LayerId { backgroundLayer, staticOverlayLayer };
+    LayerRenderer layerRenderer { "magic.RIDE Waveform Layers" };
     
     // Offscreen waveform image (scrolls continuously)
     juce::Image waveformImage;
@@ -196,7 +231,8 @@ private:
     // Pending sample data (queue for new columns)
     std::vector<SampleData> pendingData;
     int pendingReadIndex = 0;     // Read cursor into pendingData (avoids O(n) erase)
-    juce::SpinLock pendingLock;
+    mutable juce::SpinLock pendingLock;
+    static constexpr int pendingCapacity = 2048;
     
     // Pre-allocated frame data buffer (avoids heap allocation every frame)
     std::vector<SampleData> frameDataBuffer;
@@ -225,6 +261,10 @@ private:
     // Raw sample data history (one per column, for rebuilding on zoom changes)
     std::vector<SampleData> columnRawData;
     void rebuildWaveformFromRawData();
+    
+    // Columns scrolled in since the last real audio column (tail scroll), so a
+    // gain preview lines up with the audio it was rendered from
+    int columnsSinceAudio = 0;
 
     // Parameters (separate boost and cut)
     std::atomic<float> targetLevelDb { -18.0f };